@@ -1,11 +1,19 @@
 #include <iostream>
 #include <fstream>
 #include <cstdlib>
+#include <cstdio>
 #include <ctime>
 #include <string>
 #include <chrono>
 #include <iomanip>
 #include <climits>
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <cmath>
+#include <sstream>
+#include <unordered_map>
+#include "trace.h"
 
 using namespace std;
 using namespace std::chrono;
@@ -24,263 +32,454 @@ struct AdjListNode {
     AdjListNode* next;
 };
 
-// Struktura do reprezentowania grafu
-class Graph {
-private:
-    int V; // liczba wierzchołków
-    int E; // liczba krawędzi
-    double density; // gęstość grafu
-
-    // Reprezentacja macierzowa
-    int** adjMatrix;
+// Kopiec binarny minimum indeksowany numerami wierzchołków (zmniejszanie klucza w O(log V))
+struct IndexedMinHeap {
+    int* heap; // wierzchołki w kolejności kopca
+    int* pos;  // pozycja wierzchołka w kopcu (-1 - brak w kopcu)
+    int* key;  // klucze wierzchołków
+    int size;
 
-    // Reprezentacja listowa
-    AdjListNode** adjList;
+    IndexedMinHeap(int capacity) {
+        heap = new int[capacity];
+        pos = new int[capacity];
+        key = new int[capacity];
+        size = 0;
+        for (int i = 0; i < capacity; i++) {
+            pos[i] = -1;
+        }
+    }
 
-    // Pomocnicza funkcja do losowania liczb
-    int random(int min, int max) {
-        return min + rand() % (max - min + 1);
+    ~IndexedMinHeap() {
+        delete[] heap;
+        delete[] pos;
+        delete[] key;
     }
 
-public:
-    // Konstruktor
-    Graph(int vertices) {
-        this->V = vertices;
-        this->E = 0;
-        this->density = 0.0;
+    bool empty() { return size == 0; }
 
-        // Inicjalizacja macierzy sąsiedztwa
-        adjMatrix = new int*[V];
-        for (int i = 0; i < V; i++) {
-            adjMatrix[i] = new int[V];
-            for (int j = 0; j < V; j++) {
-                adjMatrix[i][j] = 0; // 0 oznacza brak krawędzi
-            }
+    // Wstaw wierzchołek lub zmniejsz jego klucz
+    void pushOrDecrease(int v, int k) {
+        if (pos[v] == -1) {
+            heap[size] = v;
+            pos[v] = size;
+            size++;
+        } else if (k >= key[v]) {
+            return;
         }
+        key[v] = k;
+        siftUp(pos[v]);
+    }
 
-        // Inicjalizacja listy sąsiedztwa
-        adjList = new AdjListNode*[V];
-        for (int i = 0; i < V; i++) {
-            adjList[i] = nullptr;
+    // Usuń i zwróć wierzchołek o najmniejszym kluczu
+    int popMin() {
+        int top = heap[0];
+        pos[top] = -1;
+        size--;
+        if (size > 0) {
+            heap[0] = heap[size];
+            pos[heap[0]] = 0;
+            siftDown(0);
         }
+        return top;
     }
 
-    // Destruktor
-    ~Graph() {
-        // Zwolnienie pamięci macierzy sąsiedztwa
-        for (int i = 0; i < V; i++) {
-            delete[] adjMatrix[i];
+    void siftUp(int i) {
+        int v = heap[i];
+        while (i > 0) {
+            int parent = (i - 1) / 2;
+            if (key[heap[parent]] <= key[v]) break;
+            heap[i] = heap[parent];
+            pos[heap[i]] = i;
+            i = parent;
         }
-        delete[] adjMatrix;
+        heap[i] = v;
+        pos[v] = i;
+    }
 
-        // Zwolnienie pamięci listy sąsiedztwa
-        for (int i = 0; i < V; i++) {
-            AdjListNode* current = adjList[i];
-            while (current) {
-                AdjListNode* temp = current;
-                current = current->next;
-                delete temp;
-            }
+    void siftDown(int i) {
+        int v = heap[i];
+        while (true) {
+            int child = 2 * i + 1;
+            if (child >= size) break;
+            if (child + 1 < size && key[heap[child + 1]] < key[heap[child]]) child++;
+            if (key[v] <= key[heap[child]]) break;
+            heap[i] = heap[child];
+            pos[heap[i]] = i;
+            i = child;
         }
-        delete[] adjList;
+        heap[i] = v;
+        pos[v] = i;
     }
+};
 
-    // Dodanie krawędzi do grafu
-    void addEdge(int src, int dest, int weight) {
-        // Aktualizacja macierzy sąsiedztwa
-        adjMatrix[src][dest] = weight;
-        adjMatrix[dest][src] = weight; // Graf nieskierowany dla MST
+// Żądanie relaksacji krawędzi w algorytmie delta-stepping
+struct RelaxRequest {
+    int vertex;
+    int distance;
+    int predecessor;
+};
 
-        // Dodanie do listy sąsiedztwa dla źródła
-        AdjListNode* newNode = new AdjListNode;
-        newNode->dest = dest;
-        newNode->weight = weight;
-        newNode->next = adjList[src];
-        adjList[src] = newNode;
+// Iterator po skompresowanej liście sąsiedztwa jednego wierzchołka.
+// Sąsiedzi są posortowani i zapisani jako różnice (varint, 7 bitów na bajt),
+// a po każdej różnicy następuje waga zapisana na stałej liczbie bajtów (little-endian).
+struct CompressedNeighborIterator {
+    const unsigned char* p; // bieżąca pozycja w danych
+    int remaining;          // liczba sąsiadów do zdekodowania
+    int weightBytes;        // szerokość zapisu wagi w bajtach
+    int weightBase;         // przesunięcie wag (najmniejsza waga w grafie)
+    int dest;               // ostatnio zdekodowany sąsiad
+    int weight;             // waga krawędzi do ostatnio zdekodowanego sąsiada
 
-        // Dodanie do listy sąsiedztwa dla celu (graf nieskierowany)
-        newNode = new AdjListNode;
-        newNode->dest = src;
-        newNode->weight = weight;
-        newNode->next = adjList[dest];
-        adjList[dest] = newNode;
+    bool next() {
+        if (remaining == 0) return false;
+        remaining--;
 
-        E++; // Zwiększ liczbę krawędzi
-        // Aktualizacja gęstości
-        int maxEdges = V * (V - 1) / 2; // Dla grafu nieskierowanego
-        density = (double)E / maxEdges;
+        unsigned int gap = *p++;
+        if (gap & 0x80) {
+            gap &= 0x7F;
+            int shift = 7;
+            unsigned char b;
+            do {
+                b = *p++;
+                gap |= (unsigned int)(b & 0x7F) << shift;
+                shift += 7;
+            } while (b & 0x80);
+        }
+        dest += (int)gap;
+
+        unsigned int raw = p[0];
+        switch (weightBytes) {
+            case 4: raw |= (unsigned int)p[3] << 24; // fall through
+            case 3: raw |= (unsigned int)p[2] << 16; // fall through
+            case 2: raw |= (unsigned int)p[1] << 8;  // fall through
+            default: break;
+        }
+        p += weightBytes;
+        weight = (int)((unsigned int)weightBase + raw);
+        return true;
     }
+};
 
-    // Wczytaj graf z pliku
-    bool loadFromFile(const string& filename) {
-        ifstream file(filename);
-        if (!file.is_open()) {
-            cout << "Nie można otworzyć pliku " << filename << endl;
-            return false;
+// Pamięć procesu w bajtach według /proc/self/status: pole "VmHWM" - szczytowa, "VmRSS" - bieżąca
+// (-1 - niedostępne w tym systemie)
+inline long long processMemoryBytes(const string& field) {
+#ifdef __linux__
+    ifstream status("/proc/self/status");
+    string line;
+    while (getline(status, line)) {
+        if (line.compare(0, field.size(), field) == 0 && line.size() > field.size() && line[field.size()] == ':') {
+            return atoll(line.c_str() + field.size() + 1) * 1024;
         }
+    }
+#endif
+    return -1;
+}
 
-        // Wyczyszczenie poprzednich danych
-        for (int i = 0; i < V; i++) {
-            for (int j = 0; j < V; j++) {
-                adjMatrix[i][j] = 0;
-            }
+// Szacowana pamięć listy sąsiedztwa w bajtach: tablica głów i węzły
+// (każdy węzeł zaokrąglony do bloku malloc z glibc)
+inline long long adjListMemoryBytes(int vertices, AdjListNode** adjList) {
+    long long nodeBytes = ((long long)sizeof(AdjListNode) + sizeof(size_t) + 15) / 16 * 16;
+    if (nodeBytes < 32) nodeBytes = 32;
+    long long nodes = 0;
+    for (int i = 0; i < vertices; i++) {
+        for (AdjListNode* node = adjList[i]; node; node = node->next) nodes++;
+    }
+    return (long long)vertices * sizeof(AdjListNode*) + nodes * nodeBytes;
+}
 
-            AdjListNode* current = adjList[i];
-            while (current) {
-                AdjListNode* temp = current;
-                current = current->next;
-                delete temp;
-            }
-            adjList[i] = nullptr;
+// Zwolnienie listy sąsiedztwa razem z tablicą głów
+inline void freeAdjList(int vertices, AdjListNode** adjList) {
+    for (int i = 0; i < vertices; i++) {
+        AdjListNode* current = adjList[i];
+        while (current) {
+            AdjListNode* temp = current;
+            current = current->next;
+            delete temp;
         }
+    }
+    delete[] adjList;
+}
 
-        int edges, vertices;
-        file >> edges >> vertices;
+// Wczytaj z pliku (format jak w Graph::loadFromFile) samą listę sąsiedztwa, bez macierzy;
+// nullptr - błąd pliku
+inline AdjListNode** loadAdjListFromFile(const string& filename, int& vertices, long long& edges) {
+    ifstream file(filename);
+    if (!file.is_open()) {
+        cout << "Nie można otworzyć pliku " << filename << endl;
+        return nullptr;
+    }
+    if (!(file >> edges >> vertices) || edges < 0 || vertices < 0) {
+        cout << "Nieprawidłowy nagłówek pliku " << filename << endl;
+        return nullptr;
+    }
 
-        // Sprawdzenie czy liczba wierzchołków się zgadza
-        if (vertices != V) {
-            cout << "Liczba wierzchołków w pliku (" << vertices << ") różni się od aktualnej (" << V << ")." << endl;
-            file.close();
-            return false;
+    AdjListNode** adjList = new AdjListNode*[vertices];
+    for (int i = 0; i < vertices; i++) adjList[i] = nullptr;
+    for (long long i = 0; i < edges; i++) {
+        int src, dest, weight;
+        if (!(file >> src >> dest >> weight)) {
+            cout << "Plik " << filename << " zawiera mniej krawędzi niż podano w nagłówku." << endl;
+            freeAdjList(vertices, adjList);
+            return nullptr;
         }
-
-        E = 0; // Zerowanie liczby krawędzi
-        
-        for (int i = 0; i < edges; i++) {
-            int src, dest, weight;
-            file >> src >> dest >> weight;
-            
-            if (src >= V || dest >= V || src < 0 || dest < 0) {
-                cout << "Błędne indeksy wierzchołków w pliku: " << src << " lub " << dest << endl;
-                file.close();
-                return false;
-            }
-            
-            addEdge(src, dest, weight);
+        if (src >= vertices || dest >= vertices || src < 0 || dest < 0) {
+            cout << "Błędne indeksy wierzchołków w pliku: " << src << " lub " << dest << endl;
+            freeAdjList(vertices, adjList);
+            return nullptr;
         }
+        adjList[src] = new AdjListNode{dest, weight, adjList[src]};
+        adjList[dest] = new AdjListNode{src, weight, adjList[dest]};
+    }
+    return adjList;
+}
 
-        file.close();
-        return true;
+// Graf przechowywany wyłącznie w postaci skompresowanej - bez macierzy i listy sąsiedztwa.
+// Może powstać z listy sąsiedztwa obiektu Graph albo zostać wczytany wprost z pliku,
+// co pozwala przetwarzać grafy, których lista węzłów na stercie nie mieści się w pamięci.
+class CompressedGraph {
+private:
+    int V;                 // liczba wierzchołków
+    long long E;           // liczba krawędzi (nieskierowanych)
+    unsigned char* data;   // zakodowani sąsiedzi wszystkich wierzchołków
+    long long* offset;     // początek danych wierzchołka v (V + 1 wartości)
+    int* degree;           // stopnie wierzchołków
+    int weightBytes;       // szerokość zapisu wagi w bajtach
+    int weightBase;        // najmniejsza waga w grafie
+
+    void release() {
+        delete[] data;
+        delete[] offset;
+        delete[] degree;
+        data = nullptr;
+        offset = nullptr;
+        degree = nullptr;
     }
 
-    // Wygeneruj losowy graf o zadanej gęstości
-    void generateRandom(double targetDensity) {
-        // Wyczyszczenie poprzednich danych
-        for (int i = 0; i < V; i++) {
-            for (int j = 0; j < V; j++) {
-                adjMatrix[i][j] = 0;
+    // Zakoduj sąsiadów zapisanych w tablicach CSR: wierzchołek u ma sąsiadów
+    // dest[start[u]..start[u+1]) z wagami weight[...]; kolejność w obrębie wierzchołka dowolna
+    void encode(int vertices, long long edges, const long long* start, int* dest, int* weight, int minWeight, int maxWeight) {
+        release();
+        V = vertices;
+        E = edges;
+
+        if (minWeight > maxWeight) minWeight = maxWeight = 0;
+        weightBase = minWeight;
+        unsigned int range = (unsigned int)maxWeight - (unsigned int)minWeight;
+        weightBytes = range < (1u << 8) ? 1 : range < (1u << 16) ? 2 : range < (1u << 24) ? 3 : 4;
+
+        // Pierwsze przejście: posortuj sąsiadów każdego wierzchołka i policz rozmiar danych
+        degree = new int[V];
+        offset = new long long[V + 1];
+        vector<pair<int, int>> neighbors;
+        long long bytes = 0;
+        for (int u = 0; u < V; u++) {
+            offset[u] = bytes;
+            degree[u] = (int)(start[u + 1] - start[u]);
+
+            neighbors.clear();
+            for (long long k = start[u]; k < start[u + 1]; k++) {
+                neighbors.push_back({dest[k], weight[k]});
             }
+            sort(neighbors.begin(), neighbors.end());
 
-            AdjListNode* current = adjList[i];
-            while (current) {
-                AdjListNode* temp = current;
-                current = current->next;
-                delete temp;
+            int previous = 0;
+            long long k = start[u];
+            for (const pair<int, int>& n : neighbors) {
+                dest[k] = n.first;
+                weight[k++] = n.second;
+                for (unsigned int gap = (unsigned int)(n.first - previous); gap >= 0x80; gap >>= 7) bytes++;
+                bytes += 1 + weightBytes;
+                previous = n.first;
             }
-            adjList[i] = nullptr;
         }
+        offset[V] = bytes;
 
-        E = 0; // Zerowanie liczby krawędzi
+        // Drugie przejście: zapis różnic (varint) i wag o stałej szerokości
+        data = new unsigned char[bytes + 1];
+        unsigned char* p = data;
+        for (int u = 0; u < V; u++) {
+            int previous = 0;
+            for (long long k = start[u]; k < start[u + 1]; k++) {
+                unsigned int gap = (unsigned int)(dest[k] - previous);
+                previous = dest[k];
+                while (gap >= 0x80) {
+                    *p++ = (unsigned char)(gap | 0x80);
+                    gap >>= 7;
+                }
+                *p++ = (unsigned char)gap;
 
-        // Najpierw generujemy drzewo rozpinające (V-1 krawędzi)
-        bool* visited = new bool[V];
-        for (int i = 0; i < V; i++) {
-            visited[i] = false;
+                unsigned int raw = (unsigned int)weight[k] - (unsigned int)weightBase;
+                for (int b = 0; b < weightBytes; b++) {
+                    *p++ = (unsigned char)(raw >> (8 * b));
+                }
+            }
         }
+    }
 
-        visited[0] = true; // Zaczynamy od wierzchołka 0
-        int visitedCount = 1;
+public:
+    CompressedGraph() {
+        this->V = 0;
+        this->E = 0;
+        this->data = nullptr;
+        this->offset = nullptr;
+        this->degree = nullptr;
+        this->weightBytes = 1;
+        this->weightBase = 0;
+    }
 
-        // Generujemy drzewo rozpinające
-        while (visitedCount < V) {
-            int src = random(0, V - 1);
-            if (!visited[src]) continue;
+    ~CompressedGraph() {
+        release();
+    }
 
-            int dest = random(0, V - 1);
-            if (visited[dest] || src == dest) continue;
+    CompressedGraph(const CompressedGraph&) = delete;
+    CompressedGraph& operator=(const CompressedGraph&) = delete;
 
-            int weight = random(1, 100); // Losowa waga od 1 do 100
-            addEdge(src, dest, weight);
-            visited[dest] = true;
-            visitedCount++;
+    // Zbuduj z listy sąsiedztwa (każda krawędź występuje na liście obu końców)
+    void buildFromList(int vertices, AdjListNode** adjList) {
+        long long* start = new long long[vertices + 1];
+        int minWeight = INT_MAX, maxWeight = INT_MIN;
+        start[0] = 0;
+        for (int u = 0; u < vertices; u++) {
+            start[u + 1] = start[u];
+            for (AdjListNode* current = adjList[u]; current; current = current->next) {
+                if (current->weight < minWeight) minWeight = current->weight;
+                if (current->weight > maxWeight) maxWeight = current->weight;
+                start[u + 1]++;
+            }
         }
 
-        delete[] visited;
-
-        // Oblicz ile jeszcze krawędzi trzeba dodać, aby osiągnąć zadaną gęstość
-        int maxEdges = V * (V - 1) / 2; // Maksymalna liczba krawędzi w grafie nieskierowanym
-        int targetEdges = (int)(targetDensity * maxEdges);
-        int remainingEdges = targetEdges - E;
-
-        // Dodawanie pozostałych krawędzi
-        while (remainingEdges > 0) {
-            int src = random(0, V - 1);
-            int dest = random(0, V - 1);
-            
-            // Pomijamy pętle i już istniejące krawędzie
-            if (src == dest || adjMatrix[src][dest] != 0) {
-                continue;
+        int* dest = new int[start[vertices] + 1];
+        int* weight = new int[start[vertices] + 1];
+        for (int u = 0; u < vertices; u++) {
+            long long k = start[u];
+            for (AdjListNode* current = adjList[u]; current; current = current->next) {
+                dest[k] = current->dest;
+                weight[k++] = current->weight;
             }
-            
-            int weight = random(1, 100); // Losowa waga od 1 do 100
-            addEdge(src, dest, weight);
-            remainingEdges--;
         }
+
+        encode(vertices, start[vertices] / 2, start, dest, weight, minWeight, maxWeight);
+
+        delete[] start;
+        delete[] dest;
+        delete[] weight;
     }
 
-    // Wyświetl graf w reprezentacji macierzowej
-    void displayMatrix() {
-        cout << "Reprezentacja macierzowa grafu:" << endl;
-        cout << "  ";
-        for (int i = 0; i < V; i++) {
-            cout << setw(4) << i;
+    // Wczytaj graf wprost z pliku (format jak w Graph::loadFromFile) w dwóch przejściach:
+    // pierwsze liczy stopnie, drugie wypełnia tablice sąsiadów - bez listy i macierzy sąsiedztwa
+    bool loadFromFile(const string& filename) {
+        TRACE_SCOPE("CompressedGraph.loadFromFile");
+
+        ifstream file(filename);
+        if (!file.is_open()) {
+            cout << "Nie można otworzyć pliku " << filename << endl;
+            return false;
         }
-        cout << endl;
-        
-        for (int i = 0; i < V; i++) {
-            cout << setw(2) << i << " ";
-            for (int j = 0; j < V; j++) {
-                cout << setw(4) << adjMatrix[i][j];
+
+        long long edges;
+        int vertices;
+        if (!(file >> edges >> vertices) || edges < 0 || vertices < 0) {
+            cout << "Nieprawidłowy nagłówek pliku " << filename << endl;
+            return false;
+        }
+
+        // Pierwsze przejście: stopnie wierzchołków i zakres wag
+        long long* start = new long long[vertices + 1];
+        for (int i = 0; i <= vertices; i++) start[i] = 0;
+        int minWeight = INT_MAX, maxWeight = INT_MIN;
+        for (long long i = 0; i < edges; i++) {
+            int src, dest, weight;
+            if (!(file >> src >> dest >> weight)) {
+                cout << "Plik " << filename << " zawiera mniej krawędzi niż podano w nagłówku." << endl;
+                delete[] start;
+                return false;
             }
-            cout << endl;
+            if (src >= vertices || dest >= vertices || src < 0 || dest < 0) {
+                cout << "Błędne indeksy wierzchołków w pliku: " << src << " lub " << dest << endl;
+                delete[] start;
+                return false;
+            }
+            start[src + 1]++;
+            start[dest + 1]++;
+            if (weight < minWeight) minWeight = weight;
+            if (weight > maxWeight) maxWeight = weight;
         }
+        for (int i = 0; i < vertices; i++) start[i + 1] += start[i];
+
+        // Drugie przejście: sąsiedzi i wagi w tablicach CSR
+        int* dest = new int[start[vertices] + 1];
+        int* weight = new int[start[vertices] + 1];
+        long long* fill = new long long[vertices];
+        for (int i = 0; i < vertices; i++) fill[i] = start[i];
+
+        file.clear();
+        file.seekg(0);
+        file >> edges >> vertices;
+        for (long long i = 0; i < edges; i++) {
+            int src, dst, w;
+            file >> src >> dst >> w;
+            dest[fill[src]] = dst;
+            weight[fill[src]++] = w;
+            dest[fill[dst]] = src;
+            weight[fill[dst]++] = w;
+        }
+        delete[] fill;
+
+        encode(vertices, edges, start, dest, weight, minWeight, maxWeight);
+
+        delete[] start;
+        delete[] dest;
+        delete[] weight;
+        return true;
     }
 
-    // Wyświetl graf w reprezentacji listowej
-    void displayList() {
-        cout << "Reprezentacja listowa grafu:" << endl;
-        for (int i = 0; i < V; i++) {
-            cout << "Wierzchołek " << i << ": ";
-            AdjListNode* current = adjList[i];
-            while (current) {
-                cout << "(" << current->dest << ", " << current->weight << ") ";
-                current = current->next;
+    // Iterator po sąsiadach wierzchołka u
+    CompressedNeighborIterator neighbors(int u) {
+        CompressedNeighborIterator it;
+        it.p = data + offset[u];
+        it.remaining = degree[u];
+        it.weightBytes = weightBytes;
+        it.weightBase = weightBase;
+        it.dest = 0;
+        it.weight = 0;
+        return it;
+    }
+
+    // Przejście po wszystkich krawędziach (pomiar przepustowości)
+    long long sweep() {
+        long long checksum = 0;
+        for (int u = 0; u < V; u++) {
+            CompressedNeighborIterator it = neighbors(u);
+            while (it.next()) {
+                checksum += it.dest + it.weight;
             }
-            cout << endl;
         }
+        return checksum;
     }
 
-    // Algorytm Prima - wersja macierzowa
-    void primMST_Matrix() { // TODO: Zastosować kolejkę priorytetową
-        cout << "\nWyniki algorytmu Prima (macierzowo):" << endl;
-        
+    // Algorytm Prima z dekodowaniem sąsiadów w locie; krawędzie MST trafiają do out
+    // (co najmniej V - 1 miejsc), zwraca ich liczbę
+    int primMST(Edge* out) {
         int* parent = new int[V]; // Tablica przechowująca MST
         int* key = new int[V];    // Tablica kluczy (min waga dla każdego wierzchołka)
         bool* mstSet = new bool[V]; // Wierzchołki włączone do MST
-        
+
         // Inicjalizacja
         for (int i = 0; i < V; i++) {
             key[i] = INT_MAX;
             mstSet[i] = false;
+            parent[i] = -1;
         }
-        
+
         // Zawsze zaczynamy od wierzchołka 0
-        key[0] = 0;
-        parent[0] = -1; // Korzeń MST
-        
+        if (V > 0) key[0] = 0;
+
+        TRACE_ACCUMULATOR(argminPhase, "primMST_Compressed.argmin");
+        TRACE_ACCUMULATOR(updatePhase, "primMST_Compressed.keyUpdate");
         // Konstruujemy MST z V wierzchołków
         for (int count = 0; count < V - 1; count++) {
             // Wybierz wierzchołek o najmniejszym kluczu spośród niewybranych
+            TRACE_ACCUM_BEGIN(argminPhase);
             int u = -1;
             int min = INT_MAX;
             for (int v = 0; v < V; v++) {
@@ -289,28 +488,974 @@ public:
                     u = v;
                 }
             }
-            
-            // Jeśli nie znaleziono wierzchołka (graf rozłączny, raczej nie powinno się wydarzyć)
+
+            TRACE_ACCUM_END(argminPhase);
+            // Jeśli nie znaleziono wierzchołka (graf rozłączny)
             if (u == -1) break;
-            
+
             mstSet[u] = true; // Dodaj do MST
-            
-            // Zaktualizuj klucze sąsiadów
-            for (int v = 0; v < V; v++) {
-                if (adjMatrix[u][v] && !mstSet[v] && adjMatrix[u][v] < key[v]) {
+
+            // Zaktualizuj klucze sąsiadów, dekodując listę w locie
+            TRACE_ACCUM_BEGIN(updatePhase);
+            CompressedNeighborIterator it = neighbors(u);
+            while (it.next()) {
+                int v = it.dest;
+                if (!mstSet[v] && it.weight < key[v]) {
                     parent[v] = u;
-                    key[v] = adjMatrix[u][v];
+                    key[v] = it.weight;
                 }
             }
+            TRACE_ACCUM_END(updatePhase);
+        }
+
+        TRACE_EMIT_BREAKDOWN(&argminPhase, &updatePhase);
+
+        // Krawędzie MST (key[i] to waga krawędzi do rodzica)
+        int count = 0;
+        for (int i = 1; i < V; i++) {
+            if (parent[i] != -1) {
+                out[count++] = {parent[i], i, key[i]};
+            }
+        }
+
+        delete[] parent;
+        delete[] key;
+        delete[] mstSet;
+        return count;
+    }
+
+    // Algorytm Borůvki - każda faza to jedno sekwencyjne przejście po wszystkich
+    // zakodowanych krawędziach; krawędzie MST trafiają do out, zwraca ich liczbę
+    int boruvkaMST(Edge* out) {
+        // Union-find (iteracyjnie, z połowieniem ścieżki)
+        int* parent = new int[V];
+        int* rank = new int[V];
+        for (int i = 0; i < V; i++) {
+            parent[i] = i;
+            rank[i] = 0;
+        }
+        auto find = [parent](int x) {
+            while (parent[x] != x) {
+                parent[x] = parent[parent[x]];
+                x = parent[x];
+            }
+            return x;
+        };
+
+        // Najtańsza krawędź wychodząca z każdej składowej (source == -1 - brak)
+        Edge* cheapest = new Edge[V];
+        int count = 0;
+
+        // Porządek liniowy krawędzi (waga, potem końce) - rozstrzyga remisy spójnie
+        auto lighter = [](int w, int a, int b, const Edge& e) {
+            if (w != e.weight) return w < e.weight;
+            int lo = a < b ? a : b, hi = a < b ? b : a;
+            int elo = e.source < e.destination ? e.source : e.destination;
+            int ehi = e.source < e.destination ? e.destination : e.source;
+            return lo != elo ? lo < elo : hi < ehi;
+        };
+
+        bool merged = true;
+        while (count < V - 1 && merged) {
+            TRACE_PHASE_BEGIN(sweepPhase, "boruvkaMST_Compressed.sweep");
+            for (int i = 0; i < V; i++) {
+                cheapest[i].source = -1;
+            }
+
+            // Przejście po wszystkich krawędziach
+            for (int u = 0; u < V; u++) {
+                int cu = find(u);
+                CompressedNeighborIterator it = neighbors(u);
+                while (it.next()) {
+                    int cv = find(it.dest);
+                    if (cu == cv) continue;
+                    if (cheapest[cu].source == -1 || lighter(it.weight, u, it.dest, cheapest[cu])) {
+                        cheapest[cu] = {u, it.dest, it.weight};
+                    }
+                }
+            }
+
+            TRACE_PHASE_END(sweepPhase);
+            TRACE_PHASE_BEGIN(mergePhase, "boruvkaMST_Compressed.merge");
+            // Połącz każdą składową przez jej najtańszą krawędź
+            merged = false;
+            for (int c = 0; c < V; c++) {
+                if (cheapest[c].source == -1) continue;
+                int x = find(cheapest[c].source);
+                int y = find(cheapest[c].destination);
+                if (x != y) {
+                    out[count++] = cheapest[c];
+                    if (rank[x] < rank[y]) parent[x] = y;
+                    else if (rank[x] > rank[y]) parent[y] = x;
+                    else {
+                        parent[y] = x;
+                        rank[x]++;
+                    }
+                    merged = true;
+                }
+            }
+        }
+
+        delete[] cheapest;
+        delete[] parent;
+        delete[] rank;
+        return count;
+    }
+
+    // Dokładna pamięć reprezentacji w bajtach
+    long long memoryBytes() {
+        if (!offset) return 0;
+        return offset[V] + (long long)(V + 1) * sizeof(long long) + (long long)V * sizeof(int);
+    }
+
+    // Gettery
+    int getVertices() { return V; }
+    long long getEdges() { return E; }
+};
+
+// Dostępne silniki MST (algorytm + reprezentacja)
+enum MSTEngine {
+    MST_PRIM_MATRIX,
+    MST_PRIM_LIST,
+    MST_KRUSKAL_MATRIX,
+    MST_KRUSKAL_LIST,
+    MST_PRIM_COMPRESSED,
+    MST_BORUVKA_COMPRESSED,
+    MST_ENGINE_COUNT
+};
+
+// Nazwa silnika MST do wyświetlania
+inline const char* mstEngineName(MSTEngine engine) {
+    switch (engine) {
+        case MST_PRIM_MATRIX: return "Prim (macierzowo)";
+        case MST_PRIM_LIST: return "Prim (listowo)";
+        case MST_KRUSKAL_MATRIX: return "Kruskal (macierzowo)";
+        case MST_KRUSKAL_LIST: return "Kruskal (listowo)";
+        case MST_PRIM_COMPRESSED: return "Prim (lista skompresowana)";
+        case MST_BORUVKA_COMPRESSED: return "Borůvka (lista skompresowana)";
+        default: return "nieznany";
+    }
+}
+
+// Domyślny plik z kalibracją modelu kosztów
+const char* const MST_CALIBRATION_FILE = "mst_calibration.txt";
+
+// Model kosztów silników MST: czas [mikrosekundy] = fixed + perUnit * praca(V, E).
+// Praca każdego silnika wynika z jego złożoności (np. V^2 dla Prima z liniowym wyborem minimum).
+struct MSTCostModel {
+    double fixed[MST_ENGINE_COUNT];
+    double perUnit[MST_ENGINE_COUNT];
+    double buildFixed;   // budowa listy skompresowanej - stały narzut
+    double buildPerUnit; // budowa listy skompresowanej - koszt jednostki pracy
+    int cores;           // liczba rdzeni maszyny, na której kalibrowano
+    bool calibrated;     // false - współczynniki domyślne
+
+    MSTCostModel() {
+        // Wartości przybliżone, zmierzone na typowej maszynie bez optymalizacji kompilatora
+        double defaults[MST_ENGINE_COUNT] = {0.021, 0.014, 0.002, 0.002, 0.012, 0.014};
+        for (int e = 0; e < MST_ENGINE_COUNT; e++) {
+            fixed[e] = 0.0;
+            perUnit[e] = defaults[e];
+        }
+        buildFixed = 0.0;
+        buildPerUnit = 0.023;
+        cores = (int)thread::hardware_concurrency();
+        calibrated = false;
+    }
+};
+
+// Model kosztów wspólny dla wszystkich grafów w programie
+inline MSTCostModel& mstCostModel() {
+    static MSTCostModel model;
+    return model;
+}
+
+// Tryby przenumerowania wierzchołków
+enum ReorderMode {
+    REORDER_NONE,   // bez przenumerowania
+    REORDER_BFS,    // kolejność przeszukiwania wszerz
+    REORDER_RCM,    // Reverse Cuthill-McKee
+    REORDER_DEGREE  // malejący stopień wierzchołka
+};
+
+// Nazwa trybu przenumerowania do wyświetlania
+inline const char* reorderModeName(ReorderMode mode) {
+    switch (mode) {
+        case REORDER_BFS: return "BFS";
+        case REORDER_RCM: return "RCM";
+        case REORDER_DEGREE: return "stopień";
+        default: return "brak";
+    }
+}
+
+// Struktura do reprezentowania grafu
+class Graph {
+private:
+    int V; // liczba wierzchołków
+    int E; // liczba krawędzi
+    double density; // gęstość grafu
+
+    // Reprezentacja macierzowa
+    int** adjMatrix;
+
+    // Reprezentacja listowa
+    AdjListNode** adjList;
+
+    // Pierwotne numery wierzchołków po przenumerowaniu (nullptr - brak przenumerowania)
+    int* origId;
+
+    // Silnik wybrany przez ostatnie wywołanie computeMST i uzasadnienie wyboru
+    MSTEngine chosenEngine;
+    string chosenReason;
+
+    // Krawędzie ostatnio wyznaczonego MST (do weryfikacji)
+    Edge* mstEdges;
+    int mstEdgeCount;
+
+    // Reprezentacja skompresowana (budowana na żądanie z listy sąsiedztwa)
+    CompressedGraph compressed;
+    bool compValid; // czy reprezentacja skompresowana odpowiada grafowi
+
+    // Unieważnienie reprezentacji skompresowanej po zmianie grafu
+    void invalidateCompressed() {
+        compValid = false;
+    }
+
+    // Przejście po wszystkich krawędziach listy sąsiedztwa (pomiar przepustowości)
+    long long sweepList() {
+        long long checksum = 0;
+        for (int u = 0; u < V; u++) {
+            for (AdjListNode* current = adjList[u]; current; current = current->next) {
+                checksum += current->dest + current->weight;
+            }
+        }
+        return checksum;
+    }
+
+    // Przejście po wszystkich krawędziach reprezentacji skompresowanej (pomiar przepustowości)
+    long long sweepCompressed() {
+        return compressed.sweep();
+    }
+
+    // Jednostki pracy silnika MST wynikające z jego złożoności
+    static double mstEngineWork(MSTEngine engine, double v, double e) {
+        switch (engine) {
+            case MST_PRIM_MATRIX: return v * v;
+            case MST_PRIM_LIST: return v * v + 2 * e;
+            case MST_KRUSKAL_MATRIX: return v * v + e * e; // sortowanie bąbelkowe krawędzi
+            case MST_KRUSKAL_LIST: return v + 2 * e + e * e;
+            case MST_PRIM_COMPRESSED: return v * v + 2 * e;
+            case MST_BORUVKA_COMPRESSED: return (v + 2 * e) * log2(v + 2);
+            default: return 0;
+        }
+    }
+
+    // Jednostki pracy budowy listy skompresowanej (sortowanie sąsiadów każdego wierzchołka)
+    static double compressedBuildWork(double v, double e) {
+        return v + 2 * e * log2(2 * e / (v > 0 ? v : 1) + 2);
+    }
+
+    // Uruchom wskazany silnik MST
+    void runMSTEngine(MSTEngine engine) {
+        switch (engine) {
+            case MST_PRIM_MATRIX: primMST_Matrix(); break;
+            case MST_PRIM_LIST: primMST_List(); break;
+            case MST_KRUSKAL_MATRIX: kruskalMST_Matrix(); break;
+            case MST_KRUSKAL_LIST: kruskalMST_List(); break;
+            case MST_PRIM_COMPRESSED: primMST_Compressed(); break;
+            case MST_BORUVKA_COMPRESSED: boruvkaMST_Compressed(); break;
+            default: break;
+        }
+    }
+
+    // Dopasowanie prostej czas = a + b * praca metodą najmniejszych kwadratów
+    static void fitCost(const vector<double>& work, const vector<double>& time, double& a, double& b) {
+        int n = (int)work.size();
+        double sw = 0, st = 0, sww = 0, swt = 0;
+        for (int i = 0; i < n; i++) {
+            sw += work[i];
+            st += time[i];
+            sww += work[i] * work[i];
+            swt += work[i] * time[i];
+        }
+        double det = n * sww - sw * sw;
+        a = 0;
+        b = 0;
+        if (n >= 2 && det > 0) {
+            a = (st * sww - sw * swt) / det;
+            b = (n * swt - sw * st) / det;
+        }
+        // Ujemny narzut lub nachylenie nie mają sensu - dopasuj prostą przez początek układu
+        if (a < 0 || b <= 0) {
+            a = 0;
+            b = sww > 0 ? swt / sww : 0;
+        }
+    }
+
+    // Pomocnicza funkcja do losowania liczb
+    int random(int min, int max) {
+        return min + rand() % (max - min + 1);
+    }
+
+    // Numer wierzchołka do wyświetlenia (pierwotny, sprzed przenumerowania)
+    int label(int v) {
+        return origId ? origId[v] : v;
+    }
+
+    // Usunięcie informacji o przenumerowaniu (np. po wczytaniu nowego grafu)
+    void resetLabels() {
+        delete[] origId;
+        origId = nullptr;
+    }
+
+    // Kolejność przeszukiwania wszerz; dla Cuthill-McKee każda składowa zaczyna się
+    // od wierzchołka o najmniejszym stopniu, a sąsiedzi dokładani są rosnąco według stopnia
+    void computeBFSOrder(int* order, int* degree, bool cuthillMcKee) {
+        bool* visited = new bool[V];
+        int* starts = new int[V]; // kolejność wyboru wierzchołków startowych
+        for (int i = 0; i < V; i++) {
+            visited[i] = false;
+            starts[i] = i;
+        }
+        if (cuthillMcKee) {
+            sort(starts, starts + V, [degree](int a, int b) {
+                return degree[a] != degree[b] ? degree[a] < degree[b] : a < b;
+            });
+        }
+
+        int head = 0, tail = 0;
+        for (int s = 0; s < V; s++) {
+            int start = starts[s];
+            if (visited[start]) continue;
+
+            visited[start] = true;
+            order[tail++] = start;
+            while (head < tail) {
+                int u = order[head++];
+                int first = tail;
+                AdjListNode* current = adjList[u];
+                while (current) {
+                    if (!visited[current->dest]) {
+                        visited[current->dest] = true;
+                        order[tail++] = current->dest;
+                    }
+                    current = current->next;
+                }
+                if (cuthillMcKee) {
+                    sort(order + first, order + tail, [degree](int a, int b) {
+                        return degree[a] != degree[b] ? degree[a] < degree[b] : a < b;
+                    });
+                }
+            }
+        }
+
+        delete[] visited;
+        delete[] starts;
+    }
+
+    // Przebuduj obie reprezentacje tak, aby wierzchołek order[k] otrzymał numer k
+    void applyOrder(int* order) {
+        int* newId = new int[V];
+        for (int k = 0; k < V; k++) {
+            newId[order[k]] = k;
+        }
+
+        // Macierz sąsiedztwa
+        int** newMatrix = new int*[V];
+        for (int i = 0; i < V; i++) {
+            newMatrix[i] = new int[V];
+            int* oldRow = adjMatrix[order[i]];
+            for (int j = 0; j < V; j++) {
+                newMatrix[i][j] = oldRow[order[j]];
+            }
+        }
+        for (int i = 0; i < V; i++) {
+            delete[] adjMatrix[i];
+        }
+        delete[] adjMatrix;
+        adjMatrix = newMatrix;
+
+        // Lista sąsiedztwa - węzły alokowane na nowo w kolejności nowych numerów,
+        // aby sąsiedzi kolejnych wierzchołków leżeli blisko siebie w pamięci
+        AdjListNode** newList = new AdjListNode*[V];
+        for (int k = 0; k < V; k++) {
+            newList[k] = nullptr;
+            AdjListNode** tail = &newList[k];
+            AdjListNode* current = adjList[order[k]];
+            while (current) {
+                AdjListNode* newNode = new AdjListNode;
+                newNode->dest = newId[current->dest];
+                newNode->weight = current->weight;
+                newNode->next = nullptr;
+                *tail = newNode;
+                tail = &newNode->next;
+                current = current->next;
+            }
+        }
+        for (int i = 0; i < V; i++) {
+            AdjListNode* current = adjList[i];
+            while (current) {
+                AdjListNode* temp = current;
+                current = current->next;
+                delete temp;
+            }
+        }
+        delete[] adjList;
+        adjList = newList;
+
+        // Złożenie z poprzednim przenumerowaniem
+        int* newOrig = new int[V];
+        for (int k = 0; k < V; k++) {
+            newOrig[k] = label(order[k]);
+        }
+        delete[] origId;
+        origId = newOrig;
+        mstEdgeCount = 0; // Zapamiętane MST dotyczy starej numeracji
+        invalidateCompressed();
+
+        delete[] newId;
+    }
+
+    // Wyświetl odległości i ścieżki najkrótsze ze źródła oraz sumę odległości
+    void printShortestPaths(int source, int* dist, int* pred) {
+        int* path = new int[V];
+        long long totalDistance = 0;
+        cout << "Źródło: " << label(source) << endl;
+        cout << "Wierzchołek \tOdległość \tŚcieżka\n";
+        for (int v = 0; v < V; v++) {
+            cout << label(v) << " \t";
+            if (dist[v] == INT_MAX) {
+                cout << "brak \t-" << endl;
+                continue;
+            }
+            totalDistance += dist[v];
+            int length = 0;
+            for (int u = v; u != -1; u = pred[u]) {
+                path[length++] = u;
+            }
+            cout << dist[v] << " \t";
+            for (int k = length - 1; k >= 0; k--) {
+                cout << label(path[k]) << (k > 0 ? " -> " : "");
+            }
+            cout << endl;
+        }
+        cout << "Suma odległości: " << totalDistance << endl;
+        delete[] path;
+    }
+
+    // Generuj żądania relaksacji dla krawędzi lekkich (w <= delta) lub ciężkich (w > delta)
+    // wychodzących z wierzchołków frontier[begin..end); czyta tylko dist, więc może działać równolegle
+    void collectRequests(const int* frontier, int begin, int end, bool useMatrix, bool light,
+                         int delta, const int* dist, vector<RelaxRequest>& out) {
+        for (int k = begin; k < end; k++) {
+            int u = frontier[k];
+            int du = dist[u];
+            if (useMatrix) {
+                int* row = adjMatrix[u];
+                for (int v = 0; v < V; v++) {
+                    int w = row[v];
+                    if (w == 0 || (w <= delta) != light) continue;
+                    if (du + w < dist[v]) out.push_back({v, du + w, u});
+                }
+            } else {
+                AdjListNode* current = adjList[u];
+                while (current) {
+                    int w = current->weight;
+                    if ((w <= delta) == light && du + w < dist[current->dest]) {
+                        out.push_back({current->dest, du + w, u});
+                    }
+                    current = current->next;
+                }
+            }
+        }
+    }
+
+    // Rdzeń algorytmu delta-stepping (Meyer, Sanders): wierzchołki w kubełkach szerokości delta,
+    // krawędzie lekkie relaksowane wielokrotnie w obrębie kubełka, ciężkie raz po jego opróżnieniu.
+    // Żądania relaksacji generowane są równolegle, a stosowane sekwencyjnie.
+    void deltaSteppingCore(int source, bool useMatrix, int numThreads, int* dist, int* pred) {
+        if (numThreads <= 0) numThreads = (int)thread::hardware_concurrency();
+        if (numThreads <= 0) numThreads = 1;
+
+        // Szerokość kubełka: maksymalna waga podzielona przez średni stopień
+        int maxWeight = 1;
+        for (int i = 0; i < V; i++) {
+            for (AdjListNode* current = adjList[i]; current; current = current->next) {
+                if (current->weight > maxWeight) maxWeight = current->weight;
+            }
+        }
+        int avgDegree = V > 0 ? 2 * E / V : 0;
+        int delta = avgDegree > 0 ? maxWeight / avgDegree : maxWeight;
+        if (delta < 1) delta = 1;
+
+        for (int i = 0; i < V; i++) {
+            dist[i] = INT_MAX;
+            pred[i] = -1;
+        }
+
+        vector<vector<int>> buckets;
+        auto relax = [&](int v, int d, int p) {
+            if (d >= dist[v]) return;
+            dist[v] = d;
+            pred[v] = p;
+            size_t b = d / delta;
+            if (b >= buckets.size()) buckets.resize(b + 1);
+            buckets[b].push_back(v);
+        };
+
+        vector<vector<RelaxRequest>> requests(numThreads);
+        // Generuj żądania dla całej tablicy wierzchołków, dzieląc ją między wątki
+        auto generate = [&](const vector<int>& frontier, bool light) {
+            int n = (int)frontier.size();
+            // Przy małej liczbie krawędzi do przejrzenia wątki się nie opłacają
+            long long work = useMatrix ? (long long)n * V : (long long)n * (avgDegree + 1);
+            int workers = work < 32768 ? 1 : min(numThreads, n);
+            for (int t = 0; t < workers; t++) requests[t].clear();
+            if (workers == 1) {
+                collectRequests(frontier.data(), 0, n, useMatrix, light, delta, dist, requests[0]);
+                return 1;
+            }
+            vector<thread> threads;
+            for (int t = 0; t < workers; t++) {
+                int begin = (int)((long long)n * t / workers);
+                int end = (int)((long long)n * (t + 1) / workers);
+                threads.emplace_back([&, t, begin, end]() {
+                    TRACE_WORKER_SCOPE("deltaStepping.collect", t);
+                    collectRequests(frontier.data(), begin, end, useMatrix, light, delta, dist, requests[t]);
+                });
+            }
+            for (thread& th : threads) th.join();
+            return workers;
+        };
+
+        int* stamp = new int[V]; // numer ostatniej rundy, w której wierzchołek trafił do frontier
+        bool* inR = new bool[V];
+        for (int i = 0; i < V; i++) {
+            stamp[i] = -1;
+            inR[i] = false;
+        }
+
+        TRACE_ACCUMULATOR(lightPhase, "deltaStepping.lightEdges");
+        TRACE_ACCUMULATOR(heavyPhase, "deltaStepping.heavyEdges");
+        relax(source, 0, -1);
+        vector<int> frontier, settled;
+        int round = 0;
+        for (size_t b = 0; b < buckets.size(); b++) {
+            settled.clear();
+            while (!buckets[b].empty()) {
+                frontier.clear();
+                // Pomiń nieaktualne wpisy i duplikaty
+                for (int v : buckets[b]) {
+                    if ((size_t)(dist[v] / delta) != b || stamp[v] == round) continue;
+                    stamp[v] = round;
+                    frontier.push_back(v);
+                    if (!inR[v]) {
+                        inR[v] = true;
+                        settled.push_back(v);
+                    }
+                }
+                buckets[b].clear();
+                round++;
+
+                TRACE_ACCUM_BEGIN(lightPhase);
+                int workers = generate(frontier, true);
+                for (int t = 0; t < workers; t++) {
+                    for (const RelaxRequest& r : requests[t]) relax(r.vertex, r.distance, r.predecessor);
+                }
+                TRACE_ACCUM_END(lightPhase);
+            }
+
+            // Krawędzie ciężkie z wierzchołków ustalonych w tym kubełku
+            TRACE_ACCUM_BEGIN(heavyPhase);
+            int workers = generate(settled, false);
+            for (int t = 0; t < workers; t++) {
+                for (const RelaxRequest& r : requests[t]) relax(r.vertex, r.distance, r.predecessor);
+            }
+            TRACE_ACCUM_END(heavyPhase);
+            for (int v : settled) inR[v] = false;
+        }
+
+        TRACE_EMIT_BREAKDOWN(&lightPhase, &heavyPhase);
+
+        delete[] stamp;
+        delete[] inR;
+    }
+
+public:
+    // Konstruktor
+    Graph(int vertices) {
+        this->V = vertices;
+        this->E = 0;
+        this->density = 0.0;
+        this->origId = nullptr;
+        this->chosenEngine = MST_ENGINE_COUNT;
+        this->mstEdges = new Edge[V];
+        this->mstEdgeCount = 0;
+        this->compValid = false;
+
+        // Inicjalizacja macierzy sąsiedztwa
+        adjMatrix = new int*[V];
+        for (int i = 0; i < V; i++) {
+            adjMatrix[i] = new int[V];
+            for (int j = 0; j < V; j++) {
+                adjMatrix[i][j] = 0; // 0 oznacza brak krawędzi
+            }
+        }
+
+        // Inicjalizacja listy sąsiedztwa
+        adjList = new AdjListNode*[V];
+        for (int i = 0; i < V; i++) {
+            adjList[i] = nullptr;
+        }
+    }
+
+    // Destruktor
+    ~Graph() {
+        // Zwolnienie pamięci macierzy sąsiedztwa
+        for (int i = 0; i < V; i++) {
+            delete[] adjMatrix[i];
+        }
+        delete[] adjMatrix;
+
+        // Zwolnienie pamięci listy sąsiedztwa
+        for (int i = 0; i < V; i++) {
+            AdjListNode* current = adjList[i];
+            while (current) {
+                AdjListNode* temp = current;
+                current = current->next;
+                delete temp;
+            }
+        }
+        delete[] adjList;
+
+        delete[] origId;
+        delete[] mstEdges;
+    }
+
+    // Dodanie krawędzi do grafu
+    void addEdge(int src, int dest, int weight) {
+        // Aktualizacja macierzy sąsiedztwa
+        adjMatrix[src][dest] = weight;
+        adjMatrix[dest][src] = weight; // Graf nieskierowany dla MST
+
+        // Dodanie do listy sąsiedztwa dla źródła
+        AdjListNode* newNode = new AdjListNode;
+        newNode->dest = dest;
+        newNode->weight = weight;
+        newNode->next = adjList[src];
+        adjList[src] = newNode;
+
+        // Dodanie do listy sąsiedztwa dla celu (graf nieskierowany)
+        newNode = new AdjListNode;
+        newNode->dest = src;
+        newNode->weight = weight;
+        newNode->next = adjList[dest];
+        adjList[dest] = newNode;
+
+        invalidateCompressed();
+
+        E++; // Zwiększ liczbę krawędzi
+        // Aktualizacja gęstości
+        int maxEdges = V * (V - 1) / 2; // Dla grafu nieskierowanego
+        density = (double)E / maxEdges;
+    }
+
+    // Wczytaj graf z pliku
+    bool loadFromFile(const string& filename) {
+        TRACE_SCOPE("loadFromFile");
+        ifstream file(filename);
+        if (!file.is_open()) {
+            cout << "Nie można otworzyć pliku " << filename << endl;
+            return false;
+        }
+
+        TRACE_PHASE_BEGIN(clearPhase, "loadFromFile.clear");
+        // Wyczyszczenie poprzednich danych
+        for (int i = 0; i < V; i++) {
+            for (int j = 0; j < V; j++) {
+                adjMatrix[i][j] = 0;
+            }
+
+            AdjListNode* current = adjList[i];
+            while (current) {
+                AdjListNode* temp = current;
+                current = current->next;
+                delete temp;
+            }
+            adjList[i] = nullptr;
+        }
+
+        TRACE_PHASE_END(clearPhase);
+        int edges, vertices;
+        file >> edges >> vertices;
+
+        // Sprawdzenie czy liczba wierzchołków się zgadza
+        if (vertices != V) {
+            cout << "Liczba wierzchołków w pliku (" << vertices << ") różni się od aktualnej (" << V << ")." << endl;
+            file.close();
+            return false;
+        }
+
+        TRACE_PHASE_BEGIN(parsePhase, "loadFromFile.parse");
+        E = 0; // Zerowanie liczby krawędzi
+        resetLabels();
+        mstEdgeCount = 0;
+        invalidateCompressed();
+        
+        for (int i = 0; i < edges; i++) {
+            int src, dest, weight;
+            file >> src >> dest >> weight;
+            
+            if (src >= V || dest >= V || src < 0 || dest < 0) {
+                cout << "Błędne indeksy wierzchołków w pliku: " << src << " lub " << dest << endl;
+                file.close();
+                return false;
+            }
+            
+            addEdge(src, dest, weight);
+        }
+
+        file.close();
+        return true;
+    }
+
+    // Wygeneruj losowy graf o zadanej gęstości
+    void generateRandom(double targetDensity) {
+        TRACE_SCOPE("generateRandom");
+        TRACE_PHASE_BEGIN(clearPhase, "generateRandom.clear");
+        // Wyczyszczenie poprzednich danych
+        for (int i = 0; i < V; i++) {
+            for (int j = 0; j < V; j++) {
+                adjMatrix[i][j] = 0;
+            }
+
+            AdjListNode* current = adjList[i];
+            while (current) {
+                AdjListNode* temp = current;
+                current = current->next;
+                delete temp;
+            }
+            adjList[i] = nullptr;
+        }
+
+        TRACE_PHASE_END(clearPhase);
+        E = 0; // Zerowanie liczby krawędzi
+        resetLabels();
+        mstEdgeCount = 0;
+        invalidateCompressed();
+
+        TRACE_PHASE_BEGIN(treePhase, "generateRandom.spanningTree");
+        // Najpierw generujemy drzewo rozpinające (V-1 krawędzi)
+        bool* visited = new bool[V];
+        for (int i = 0; i < V; i++) {
+            visited[i] = false;
+        }
+
+        visited[0] = true; // Zaczynamy od wierzchołka 0
+        int visitedCount = 1;
+
+        // Generujemy drzewo rozpinające
+        while (visitedCount < V) {
+            int src = random(0, V - 1);
+            if (!visited[src]) continue;
+
+            int dest = random(0, V - 1);
+            if (visited[dest] || src == dest) continue;
+
+            int weight = random(1, 100); // Losowa waga od 1 do 100
+            addEdge(src, dest, weight);
+            visited[dest] = true;
+            visitedCount++;
+        }
+
+        delete[] visited;
+
+        TRACE_PHASE_END(treePhase);
+        TRACE_PHASE_BEGIN(extraPhase, "generateRandom.extraEdges");
+        // Oblicz ile jeszcze krawędzi trzeba dodać, aby osiągnąć zadaną gęstość
+        int maxEdges = V * (V - 1) / 2; // Maksymalna liczba krawędzi w grafie nieskierowanym
+        int targetEdges = (int)(targetDensity * maxEdges);
+        int remainingEdges = targetEdges - E;
+
+        // Dodawanie pozostałych krawędzi
+        while (remainingEdges > 0) {
+            int src = random(0, V - 1);
+            int dest = random(0, V - 1);
+            
+            // Pomijamy pętle i już istniejące krawędzie
+            if (src == dest || adjMatrix[src][dest] != 0) {
+                continue;
+            }
+            
+            int weight = random(1, 100); // Losowa waga od 1 do 100
+            addEdge(src, dest, weight);
+            remainingEdges--;
+        }
+    }
+
+    // Wyświetl graf w reprezentacji macierzowej
+    void displayMatrix() {
+        cout << "Reprezentacja macierzowa grafu:" << endl;
+        cout << "  ";
+        for (int i = 0; i < V; i++) {
+            cout << setw(4) << label(i);
+        }
+        cout << endl;
+        
+        for (int i = 0; i < V; i++) {
+            cout << setw(2) << label(i) << " ";
+            for (int j = 0; j < V; j++) {
+                cout << setw(4) << adjMatrix[i][j];
+            }
+            cout << endl;
+        }
+    }
+
+    // Wyświetl graf w reprezentacji listowej
+    void displayList() {
+        cout << "Reprezentacja listowa grafu:" << endl;
+        for (int i = 0; i < V; i++) {
+            cout << "Wierzchołek " << label(i) << ": ";
+            AdjListNode* current = adjList[i];
+            while (current) {
+                cout << "(" << label(current->dest) << ", " << current->weight << ") ";
+                current = current->next;
+            }
+            cout << endl;
+        }
+    }
+
+    // Przenumeruj wierzchołki w celu poprawy lokalności dostępu do pamięci.
+    // Algorytmy działają na nowych numerach, a wyniki wyświetlane są z pierwotnymi.
+    void reorderVertices(ReorderMode mode) {
+        if (mode == REORDER_NONE || V == 0) return;
+
+        TRACE_SCOPE("reorderVertices");
+        TRACE_PHASE_BEGIN(orderPhase, "reorderVertices.order");
+
+        int* order = new int[V]; // order[k] - obecny numer wierzchołka, który otrzyma numer k
+        int* degree = new int[V];
+        for (int i = 0; i < V; i++) {
+            degree[i] = 0;
+            AdjListNode* current = adjList[i];
+            while (current) {
+                degree[i]++;
+                current = current->next;
+            }
+        }
+
+        switch (mode) {
+            case REORDER_BFS:
+                computeBFSOrder(order, degree, false);
+                break;
+            case REORDER_RCM:
+                computeBFSOrder(order, degree, true);
+                reverse(order, order + V);
+                break;
+            case REORDER_DEGREE:
+                for (int i = 0; i < V; i++) {
+                    order[i] = i;
+                }
+                sort(order, order + V, [degree](int a, int b) {
+                    return degree[a] != degree[b] ? degree[a] > degree[b] : a < b;
+                });
+                break;
+            default:
+                break;
+        }
+
+        TRACE_PHASE_END(orderPhase);
+        TRACE_PHASE_BEGIN(applyPhase, "reorderVertices.apply");
+        applyOrder(order);
+        TRACE_PHASE_END(applyPhase);
+
+        delete[] order;
+        delete[] degree;
+    }
+
+    // Zbuduj reprezentację skompresowaną z listy sąsiedztwa
+    void buildCompressed() {
+        TRACE_SCOPE("buildCompressed");
+
+        compressed.buildFromList(V, adjList);
+        compValid = true;
+    }
+
+    // Szacowana pamięć listy sąsiedztwa w bajtach
+    long long listMemoryBytes() {
+        return adjListMemoryBytes(V, adjList);
+    }
+
+    // Dokładna pamięć reprezentacji skompresowanej w bajtach
+    long long compressedMemoryBytes() {
+        if (!compValid) buildCompressed();
+        return compressed.memoryBytes();
+    }
+
+    // Algorytm Prima - wersja macierzowa
+    void primMST_Matrix() { // TODO: Zastosować kolejkę priorytetową
+        TRACE_SCOPE("primMST_Matrix");
+        cout << "\nWyniki algorytmu Prima (macierzowo):" << endl;
+        
+        int* parent = new int[V]; // Tablica przechowująca MST
+        int* key = new int[V];    // Tablica kluczy (min waga dla każdego wierzchołka)
+        bool* mstSet = new bool[V]; // Wierzchołki włączone do MST
+        
+        // Inicjalizacja
+        for (int i = 0; i < V; i++) {
+            key[i] = INT_MAX;
+            mstSet[i] = false;
+            parent[i] = -1;
+        }
+        
+        // Zawsze zaczynamy od wierzchołka 0
+        key[0] = 0;
+        parent[0] = -1; // Korzeń MST
+        
+        TRACE_ACCUMULATOR(argminPhase, "primMST_Matrix.argmin");
+        TRACE_ACCUMULATOR(updatePhase, "primMST_Matrix.keyUpdate");
+        // Konstruujemy MST z V wierzchołków
+        for (int count = 0; count < V - 1; count++) {
+            // Wybierz wierzchołek o najmniejszym kluczu spośród niewybranych
+            TRACE_ACCUM_BEGIN(argminPhase);
+            int u = -1;
+            int min = INT_MAX;
+            for (int v = 0; v < V; v++) {
+                if (!mstSet[v] && key[v] < min) {
+                    min = key[v];
+                    u = v;
+                }
+            }
+            
+            TRACE_ACCUM_END(argminPhase);
+            // Jeśli nie znaleziono wierzchołka (graf rozłączny, raczej nie powinno się wydarzyć)
+            if (u == -1) break;
+            
+            mstSet[u] = true; // Dodaj do MST
+            
+            // Zaktualizuj klucze sąsiadów
+            TRACE_ACCUM_BEGIN(updatePhase);
+            for (int v = 0; v < V; v++) {
+                if (adjMatrix[u][v] && !mstSet[v] && adjMatrix[u][v] < key[v]) {
+                    parent[v] = u;
+                    key[v] = adjMatrix[u][v];
+                }
+            }
+            TRACE_ACCUM_END(updatePhase);
         }
         
+        TRACE_EMIT_BREAKDOWN(&argminPhase, &updatePhase);
+        TRACE_SCOPE("primMST_Matrix.output");
+
         // Wyświetl krawędzie MST i oblicz sumę wag
         int totalWeight = 0;
+        mstEdgeCount = 0;
         cout << "Krawędź \tWaga\n";
         for (int i = 1; i < V; i++) {
             if (parent[i] != -1) {
-                cout << parent[i] << " - " << i << " \t" << adjMatrix[i][parent[i]] << endl;
+                cout << label(parent[i]) << " - " << label(i) << " \t" << adjMatrix[i][parent[i]] << endl;
                 totalWeight += adjMatrix[i][parent[i]];
+                mstEdges[mstEdgeCount++] = {parent[i], i, adjMatrix[i][parent[i]]};
             }
         }
         cout << "Suma wag MST: " << totalWeight << endl;
@@ -322,6 +1467,7 @@ public:
 
     // Algorytm Prima - wersja listowa
     void primMST_List() {
+        TRACE_SCOPE("primMST_List");
         cout << "\nWyniki algorytmu Prima (listowo):" << endl;
         
         int* parent = new int[V]; // Tablica przechowująca MST
@@ -332,15 +1478,19 @@ public:
         for (int i = 0; i < V; i++) {
             key[i] = INT_MAX;
             mstSet[i] = false;
+            parent[i] = -1;
         }
         
         // Zawsze zaczynamy od wierzchołka 0
         key[0] = 0;
         parent[0] = -1; // Korzeń MST
         
+        TRACE_ACCUMULATOR(argminPhase, "primMST_List.argmin");
+        TRACE_ACCUMULATOR(updatePhase, "primMST_List.keyUpdate");
         // Konstruujemy MST z V wierzchołków
         for (int count = 0; count < V - 1; count++) {
             // Wybierz wierzchołek o najmniejszym kluczu spośród niewybranych
+            TRACE_ACCUM_BEGIN(argminPhase);
             int u = -1;
             int min = INT_MAX;
             for (int v = 0; v < V; v++) {
@@ -350,12 +1500,14 @@ public:
                 }
             }
             
+            TRACE_ACCUM_END(argminPhase);
             // // Jeśli nie znaleziono wierzchołka (graf rozłączny, raczej nie powinno się wydarzyć)
             if (u == -1) break;
             
             mstSet[u] = true; // Dodaj do MST
             
             // Zaktualizuj klucze sąsiadów
+            TRACE_ACCUM_BEGIN(updatePhase);
             AdjListNode* current = adjList[u];
             while (current) {
                 int v = current->dest;
@@ -365,10 +1517,15 @@ public:
                 }
                 current = current->next;
             }
+            TRACE_ACCUM_END(updatePhase);
         }
         
+        TRACE_EMIT_BREAKDOWN(&argminPhase, &updatePhase);
+        TRACE_SCOPE("primMST_List.output");
+
         // Wyświetl krawędzie MST i oblicz sumę wag
         int totalWeight = 0;
+        mstEdgeCount = 0;
         cout << "Krawędź \tWaga\n";
         for (int i = 1; i < V; i++) {
             if (parent[i] != -1) {
@@ -383,8 +1540,9 @@ public:
                     current = current->next;
                 }
                 
-                cout << parent[i] << " - " << i << " \t" << weight << endl;
+                cout << label(parent[i]) << " - " << label(i) << " \t" << weight << endl;
                 totalWeight += weight;
+                mstEdges[mstEdgeCount++] = {parent[i], i, weight};
             }
         }
         cout << "Suma wag MST: " << totalWeight << endl;
@@ -394,6 +1552,25 @@ public:
         delete[] mstSet;
     }
 
+    // Algorytm Prima - wersja na skompresowanej liście sąsiedztwa
+    void primMST_Compressed() {
+        TRACE_SCOPE("primMST_Compressed");
+        cout << "\nWyniki algorytmu Prima (lista skompresowana):" << endl;
+
+        if (!compValid) buildCompressed();
+        mstEdgeCount = compressed.primMST(mstEdges);
+
+        TRACE_SCOPE("primMST_Compressed.output");
+        // Wyświetl krawędzie MST i oblicz sumę wag
+        int totalWeight = 0;
+        cout << "Krawędź \tWaga\n";
+        for (int i = 0; i < mstEdgeCount; i++) {
+            cout << label(mstEdges[i].source) << " - " << label(mstEdges[i].destination) << " \t" << mstEdges[i].weight << endl;
+            totalWeight += mstEdges[i].weight;
+        }
+        cout << "Suma wag MST: " << totalWeight << endl;
+    }
+
     // Struktura pomocnicza do algorytmu Kruskala
     struct Subset {
         int parent;
@@ -429,8 +1606,10 @@ public:
 
     // Algorytm Kruskala - wersja macierzowa
     void kruskalMST_Matrix() { // TODO: Zaimplementować kopiec
+        TRACE_SCOPE("kruskalMST_Matrix");
         cout << "\nWyniki algorytmu Kruskala (macierzowo):" << endl;
         
+        TRACE_PHASE_BEGIN(extractPhase, "kruskalMST_Matrix.extract");
         // Utwórz tablicę krawędzi
         Edge* edges = new Edge[E];
         int edgeCount = 0;
@@ -447,6 +1626,93 @@ public:
             }
         }
         
+        TRACE_PHASE_END(extractPhase);
+        TRACE_PHASE_BEGIN(sortPhase, "kruskalMST_Matrix.sort");
+        // Sortowanie krawędzi (bubble sort dla prostoty)
+        for (int i = 0; i < edgeCount - 1; i++) {
+            for (int j = 0; j < edgeCount - i - 1; j++) {
+                if (edges[j].weight > edges[j + 1].weight) {
+                    Edge temp = edges[j];
+                    edges[j] = edges[j + 1];
+                    edges[j + 1] = temp;
+                }
+            }
+        }
+        
+        TRACE_PHASE_END(sortPhase);
+        TRACE_PHASE_BEGIN(unionFindPhase, "kruskalMST_Matrix.unionFind");
+        // Alokacja tablicy wynikowej MST
+        Edge* result = new Edge[V - 1];
+        
+        // Tworzenie podzbiorów dla union-find
+        Subset* subsets = new Subset[V];
+        for (int i = 0; i < V; i++) {
+            subsets[i].parent = i;
+            subsets[i].rank = 0;
+        }
+        
+        int resultIndex = 0;  // Indeks dla tablicy wynikowej
+        int i = 0;  // Indeks dla tablicy posortowanych krawędzi
+        
+        // Budowanie MST
+        while (resultIndex < V - 1 && i < edgeCount) {
+            Edge nextEdge = edges[i++];
+            
+            int x = find(subsets, nextEdge.source);
+            int y = find(subsets, nextEdge.destination);
+            
+            // Jeśli dodanie krawędzi nie tworzy cyklu, dodaj ją do MST
+            if (x != y) {
+                result[resultIndex++] = nextEdge;
+                Union(subsets, x, y);
+            }
+        }
+        
+        TRACE_PHASE_END(unionFindPhase);
+        TRACE_SCOPE("kruskalMST_Matrix.output");
+        // Wyświetl krawędzie MST i oblicz sumę wag
+        int totalWeight = 0;
+        cout << "Krawędź \tWaga\n";
+        for (i = 0; i < resultIndex; i++) {
+            cout << label(result[i].source) << " - " << label(result[i].destination) << " \t" << result[i].weight << endl;
+            totalWeight += result[i].weight;
+            mstEdges[i] = result[i];
+        }
+        mstEdgeCount = resultIndex;
+        cout << "Suma wag MST: " << totalWeight << endl;
+        
+        delete[] result;
+        delete[] subsets;
+        delete[] edges;
+    }
+
+    // Algorytm Kruskala - wersja listowa
+    void kruskalMST_List() {
+        TRACE_SCOPE("kruskalMST_List");
+        cout << "\nWyniki algorytmu Kruskala (listowo):" << endl;
+        
+        TRACE_PHASE_BEGIN(extractPhase, "kruskalMST_List.extract");
+        // Utwórz tablicę krawędzi
+        Edge* edges = new Edge[E];
+        int edgeCount = 0;
+        
+        // Wypełnij tablicę krawędzi z listy sąsiedztwa
+        for (int i = 0; i < V; i++) {
+            AdjListNode* current = adjList[i];
+            while (current) {
+                // Dodaj krawędź tylko jeśli dest > source (unikamy duplikatów w grafie nieskierowanym)
+                if (current->dest > i) {
+                    edges[edgeCount].source = i;
+                    edges[edgeCount].destination = current->dest;
+                    edges[edgeCount].weight = current->weight;
+                    edgeCount++;
+                }
+                current = current->next;
+            }
+        }
+        
+        TRACE_PHASE_END(extractPhase);
+        TRACE_PHASE_BEGIN(sortPhase, "kruskalMST_List.sort");
         // Sortowanie krawędzi (bubble sort dla prostoty)
         for (int i = 0; i < edgeCount - 1; i++) {
             for (int j = 0; j < edgeCount - i - 1; j++) {
@@ -458,6 +1724,8 @@ public:
             }
         }
         
+        TRACE_PHASE_END(sortPhase);
+        TRACE_PHASE_BEGIN(unionFindPhase, "kruskalMST_List.unionFind");
         // Alokacja tablicy wynikowej MST
         Edge* result = new Edge[V - 1];
         
@@ -485,102 +1753,592 @@ public:
             }
         }
         
+        TRACE_PHASE_END(unionFindPhase);
+        TRACE_SCOPE("kruskalMST_List.output");
         // Wyświetl krawędzie MST i oblicz sumę wag
         int totalWeight = 0;
         cout << "Krawędź \tWaga\n";
         for (i = 0; i < resultIndex; i++) {
-            cout << result[i].source << " - " << result[i].destination << " \t" << result[i].weight << endl;
+            cout << label(result[i].source) << " - " << label(result[i].destination) << " \t" << result[i].weight << endl;
             totalWeight += result[i].weight;
+            mstEdges[i] = result[i];
+        }
+        mstEdgeCount = resultIndex;
+        cout << "Suma wag MST: " << totalWeight << endl;
+        
+        delete[] result;
+        delete[] subsets;
+        delete[] edges;
+    }
+
+    // Algorytm Borůvki - wersja na skompresowanej liście sąsiedztwa
+    void boruvkaMST_Compressed() {
+        TRACE_SCOPE("boruvkaMST_Compressed");
+        cout << "\nWyniki algorytmu Borůvki (lista skompresowana):" << endl;
+
+        if (!compValid) buildCompressed();
+        mstEdgeCount = compressed.boruvkaMST(mstEdges);
+
+        TRACE_SCOPE("boruvkaMST_Compressed.output");
+        // Wyświetl krawędzie MST i oblicz sumę wag
+        int totalWeight = 0;
+        cout << "Krawędź \tWaga\n";
+        for (int i = 0; i < mstEdgeCount; i++) {
+            cout << label(mstEdges[i].source) << " - " << label(mstEdges[i].destination) << " \t" << mstEdges[i].weight << endl;
+            totalWeight += mstEdges[i].weight;
+        }
+        cout << "Suma wag MST: " << totalWeight << endl;
+    }
+
+    // Algorytm Dijkstry - wersja macierzowa, O(V^2)
+    void dijkstraSP_Matrix(int source) {
+        TRACE_SCOPE("dijkstraSP_Matrix");
+        cout << "\nWyniki algorytmu Dijkstry (macierzowo):" << endl;
+
+        int* dist = new int[V];    // Odległości od źródła
+        int* pred = new int[V];    // Poprzednicy na najkrótszych ścieżkach
+        bool* done = new bool[V];  // Wierzchołki o ustalonej odległości
+
+        for (int i = 0; i < V; i++) {
+            dist[i] = INT_MAX;
+            pred[i] = -1;
+            done[i] = false;
+        }
+        dist[source] = 0;
+
+        TRACE_ACCUMULATOR(argminPhase, "dijkstraSP_Matrix.argmin");
+        TRACE_ACCUMULATOR(relaxPhase, "dijkstraSP_Matrix.relax");
+        for (int count = 0; count < V; count++) {
+            // Wybierz nieustalony wierzchołek o najmniejszej odległości
+            TRACE_ACCUM_BEGIN(argminPhase);
+            int u = -1;
+            int min = INT_MAX;
+            for (int v = 0; v < V; v++) {
+                if (!done[v] && dist[v] < min) {
+                    min = dist[v];
+                    u = v;
+                }
+            }
+
+            TRACE_ACCUM_END(argminPhase);
+            // Pozostałe wierzchołki są nieosiągalne ze źródła
+            if (u == -1) break;
+
+            done[u] = true;
+
+            // Relaksacja krawędzi wychodzących z u
+            TRACE_ACCUM_BEGIN(relaxPhase);
+            for (int v = 0; v < V; v++) {
+                if (adjMatrix[u][v] && !done[v] && dist[u] + adjMatrix[u][v] < dist[v]) {
+                    dist[v] = dist[u] + adjMatrix[u][v];
+                    pred[v] = u;
+                }
+            }
+            TRACE_ACCUM_END(relaxPhase);
+        }
+
+        TRACE_EMIT_BREAKDOWN(&argminPhase, &relaxPhase);
+        TRACE_SCOPE("dijkstraSP_Matrix.output");
+        printShortestPaths(source, dist, pred);
+
+        delete[] dist;
+        delete[] pred;
+        delete[] done;
+    }
+
+    // Algorytm Dijkstry - wersja listowa z kopcem, O(E log V)
+    void dijkstraSP_List(int source) {
+        TRACE_SCOPE("dijkstraSP_List");
+        cout << "\nWyniki algorytmu Dijkstry (listowo):" << endl;
+
+        int* dist = new int[V];    // Odległości od źródła
+        int* pred = new int[V];    // Poprzednicy na najkrótszych ścieżkach
+        bool* done = new bool[V];  // Wierzchołki o ustalonej odległości
+
+        for (int i = 0; i < V; i++) {
+            dist[i] = INT_MAX;
+            pred[i] = -1;
+            done[i] = false;
+        }
+        dist[source] = 0;
+
+        IndexedMinHeap heap(V);
+        heap.pushOrDecrease(source, 0);
+
+        TRACE_ACCUMULATOR(popPhase, "dijkstraSP_List.heapPop");
+        TRACE_ACCUMULATOR(relaxPhase, "dijkstraSP_List.relax");
+        while (!heap.empty()) {
+            TRACE_ACCUM_BEGIN(popPhase);
+            int u = heap.popMin();
+            TRACE_ACCUM_END(popPhase);
+            done[u] = true;
+
+            // Relaksacja krawędzi wychodzących z u
+            TRACE_ACCUM_BEGIN(relaxPhase);
+            AdjListNode* current = adjList[u];
+            while (current) {
+                int v = current->dest;
+                if (!done[v] && dist[u] + current->weight < dist[v]) {
+                    dist[v] = dist[u] + current->weight;
+                    pred[v] = u;
+                    heap.pushOrDecrease(v, dist[v]);
+                }
+                current = current->next;
+            }
+            TRACE_ACCUM_END(relaxPhase);
+        }
+
+        TRACE_EMIT_BREAKDOWN(&popPhase, &relaxPhase);
+        TRACE_SCOPE("dijkstraSP_List.output");
+        printShortestPaths(source, dist, pred);
+
+        delete[] dist;
+        delete[] pred;
+        delete[] done;
+    }
+
+    // Równoległy algorytm delta-stepping - wersja macierzowa (numThreads = 0 - wszystkie rdzenie)
+    void deltaSteppingSP_Matrix(int source, int numThreads = 0) {
+        TRACE_SCOPE("deltaSteppingSP_Matrix");
+        cout << "\nWyniki algorytmu delta-stepping (macierzowo):" << endl;
+
+        int* dist = new int[V];
+        int* pred = new int[V];
+        deltaSteppingCore(source, true, numThreads, dist, pred);
+        TRACE_SCOPE("deltaSteppingSP_Matrix.output");
+        printShortestPaths(source, dist, pred);
+
+        delete[] dist;
+        delete[] pred;
+    }
+
+    // Równoległy algorytm delta-stepping - wersja listowa (numThreads = 0 - wszystkie rdzenie)
+    void deltaSteppingSP_List(int source, int numThreads = 0) {
+        TRACE_SCOPE("deltaSteppingSP_List");
+        cout << "\nWyniki algorytmu delta-stepping (listowo):" << endl;
+
+        int* dist = new int[V];
+        int* pred = new int[V];
+        deltaSteppingCore(source, false, numThreads, dist, pred);
+        TRACE_SCOPE("deltaSteppingSP_List.output");
+        printShortestPaths(source, dist, pred);
+
+        delete[] dist;
+        delete[] pred;
+    }
+
+    // Znajduje korzeń drzewa union-find z kompresją ścieżki, utrzymując maxW[x] jako
+    // maksymalną wagę krawędzi drzewa MST na ścieżce od x do korzenia (iteracyjnie)
+    int findWithMax(int* link, int* maxW, int* path, int x) {
+        int length = 0;
+        while (link[x] != x) {
+            path[length++] = x;
+            x = link[x];
+        }
+        int root = x;
+        // Od wierzchołka najbliższego korzenia w dół - maxW[link[v]] jest już liczone do korzenia
+        for (int k = length - 2; k >= 0; k--) {
+            int v = path[k];
+            if (maxW[link[v]] > maxW[v]) maxW[v] = maxW[link[v]];
+            link[v] = root;
+        }
+        return root;
+    }
+
+    // Weryfikacja MST w czasie prawie liniowym: sprawdza, czy krawędzie tworzą las rozpinający
+    // grafu oraz czy żadna krawędź grafu nie jest lżejsza od maksymalnej krawędzi na ścieżce
+    // drzewa łączącej jej końce (offline LCA Tarjana z maksimum na ścieżce)
+    bool verifyMST(const Edge* tree, int treeSize) {
+        TRACE_SCOPE("verifyMST");
+        if (treeSize > V - 1) {
+            cout << "Weryfikacja: zbyt wiele krawędzi (" << treeSize << ")." << endl;
+            return false;
+        }
+
+        bool ok = true;
+
+        TRACE_PHASE_BEGIN(treeCheckPhase, "verifyMST.treeCheck");
+        // Krawędzie drzewa muszą istnieć w grafie i nie tworzyć cyklu
+        Subset* subsets = new Subset[V];
+        for (int i = 0; i < V; i++) {
+            subsets[i].parent = i;
+            subsets[i].rank = 0;
+        }
+        for (int i = 0; i < treeSize && ok; i++) {
+            int u = tree[i].source, v = tree[i].destination;
+            if (u < 0 || v < 0 || u >= V || v >= V || u == v || adjMatrix[u][v] != tree[i].weight || tree[i].weight == 0) {
+                cout << "Weryfikacja: krawędź " << i << " nie istnieje w grafie." << endl;
+                ok = false;
+                break;
+            }
+            int x = find(subsets, u);
+            int y = find(subsets, v);
+            if (x == y) {
+                cout << "Weryfikacja: krawędzie tworzą cykl." << endl;
+                ok = false;
+                break;
+            }
+            Union(subsets, x, y);
         }
-        cout << "Suma wag MST: " << totalWeight << endl;
-        
-        delete[] result;
         delete[] subsets;
-        delete[] edges;
-    }
+        TRACE_PHASE_END(treeCheckPhase);
+        if (!ok) return false;
 
-    // Algorytm Kruskala - wersja listowa
-    void kruskalMST_List() {
-        cout << "\nWyniki algorytmu Kruskala (listowo):" << endl;
-        
-        // Utwórz tablicę krawędzi
-        Edge* edges = new Edge[E];
-        int edgeCount = 0;
-        
-        // Wypełnij tablicę krawędzi z listy sąsiedztwa
+        TRACE_PHASE_BEGIN(buildPhase, "verifyMST.build");
+        // Drzewo w postaci tablic sąsiedztwa (CSR)
+        int* treeStart = new int[V + 1];
+        int* treeAdj = new int[2 * treeSize + 1];
+        int* treeWeight = new int[2 * treeSize + 1];
+        for (int i = 0; i <= V; i++) treeStart[i] = 0;
+        for (int i = 0; i < treeSize; i++) {
+            treeStart[tree[i].source + 1]++;
+            treeStart[tree[i].destination + 1]++;
+        }
+        for (int i = 0; i < V; i++) treeStart[i + 1] += treeStart[i];
+        int* fill = new int[V];
+        for (int i = 0; i < V; i++) fill[i] = treeStart[i];
+        for (int i = 0; i < treeSize; i++) {
+            int u = tree[i].source, v = tree[i].destination;
+            treeAdj[fill[u]] = v;
+            treeWeight[fill[u]++] = tree[i].weight;
+            treeAdj[fill[v]] = u;
+            treeWeight[fill[v]++] = tree[i].weight;
+        }
+
+        // Zapytania: każda krawędź grafu, przypisana do obu końców
+        Edge* queries = new Edge[E + 1];
+        int queryCount = 0;
+        int* queryStart = new int[V + 1];
+        for (int i = 0; i <= V; i++) queryStart[i] = 0;
         for (int i = 0; i < V; i++) {
             AdjListNode* current = adjList[i];
             while (current) {
-                // Dodaj krawędź tylko jeśli dest > source (unikamy duplikatów w grafie nieskierowanym)
                 if (current->dest > i) {
-                    edges[edgeCount].source = i;
-                    edges[edgeCount].destination = current->dest;
-                    edges[edgeCount].weight = current->weight;
-                    edgeCount++;
+                    queries[queryCount++] = {i, current->dest, current->weight};
+                    queryStart[i + 1]++;
+                    queryStart[current->dest + 1]++;
                 }
                 current = current->next;
             }
         }
-        
-        // Sortowanie krawędzi (bubble sort dla prostoty)
-        for (int i = 0; i < edgeCount - 1; i++) {
-            for (int j = 0; j < edgeCount - i - 1; j++) {
-                if (edges[j].weight > edges[j + 1].weight) {
-                    Edge temp = edges[j];
-                    edges[j] = edges[j + 1];
-                    edges[j + 1] = temp;
+        for (int i = 0; i < V; i++) queryStart[i + 1] += queryStart[i];
+        int* queryAdj = new int[2 * queryCount + 1];
+        for (int i = 0; i < V; i++) fill[i] = queryStart[i];
+        for (int q = 0; q < queryCount; q++) {
+            queryAdj[fill[queries[q].source]++] = q;
+            queryAdj[fill[queries[q].destination]++] = q;
+        }
+
+        TRACE_PHASE_END(buildPhase);
+        TRACE_PHASE_BEGIN(lcaPhase, "verifyMST.lca");
+        // Stan przeszukiwania w głąb
+        int* link = new int[V];        // union-find: wskazanie w stronę przodka
+        int* maxW = new int[V];        // maksimum wag na ścieżce do link[v]
+        int* state = new int[V];       // 0 - nieodwiedzony, 1 - na stosie, 2 - zakończony
+        int* component = new int[V];   // numer drzewa lasu
+        int* treeParent = new int[V];
+        int* parentWeight = new int[V];
+        int* nextEdge = new int[V];    // następna krawędź drzewa do przejrzenia
+        int* stack = new int[V];
+        int* path = new int[V];
+        int* bucketHead = new int[V];  // zapytania, których LCA to dany wierzchołek
+        int* bucketNext = new int[queryCount + 1];
+        for (int i = 0; i < V; i++) {
+            link[i] = i;
+            maxW[i] = INT_MIN;
+            state[i] = 0;
+            bucketHead[i] = -1;
+        }
+
+        for (int root = 0; root < V && ok; root++) {
+            if (state[root] != 0) continue;
+
+            int top = 0;
+            stack[top++] = root;
+            state[root] = 1;
+            component[root] = root;
+            treeParent[root] = -1;
+            nextEdge[root] = treeStart[root];
+
+            while (top > 0 && ok) {
+                int x = stack[top - 1];
+
+                // Zejdź do kolejnego nieodwiedzonego dziecka
+                if (nextEdge[x] < treeStart[x + 1]) {
+                    int k = nextEdge[x]++;
+                    int child = treeAdj[k];
+                    if (child == treeParent[x]) continue;
+                    state[child] = 1;
+                    component[child] = root;
+                    treeParent[child] = x;
+                    parentWeight[child] = treeWeight[k];
+                    nextEdge[child] = treeStart[child];
+                    stack[top++] = child;
+                    continue;
+                }
+
+                // Wszystkie dzieci x są zakończone i podłączone do x
+                top--;
+                state[x] = 2;
+
+                // Zapytania, których drugi koniec jest już zakończony - wyznacz LCA
+                for (int k = queryStart[x]; k < queryStart[x + 1]; k++) {
+                    int q = queryAdj[k];
+                    int y = queries[q].source == x ? queries[q].destination : queries[q].source;
+                    if (state[y] != 2) continue;
+                    if (component[y] != component[x]) {
+                        cout << "Weryfikacja: drzewo nie rozpina grafu (" << label(x) << " i " << label(y) << " w różnych składowych)." << endl;
+                        ok = false;
+                        break;
+                    }
+                    int lca = findWithMax(link, maxW, path, y);
+                    bucketNext[q] = bucketHead[lca];
+                    bucketHead[lca] = q;
+                }
+
+                // Zapytania z LCA w x - oba końce są teraz w poddrzewie x, a x jest korzeniem
+                for (int q = bucketHead[x]; q != -1 && ok; q = bucketNext[q]) {
+                    int a = queries[q].source, b = queries[q].destination;
+                    findWithMax(link, maxW, path, a);
+                    findWithMax(link, maxW, path, b);
+                    int pathMax = maxW[a] > maxW[b] ? maxW[a] : maxW[b];
+                    if (queries[q].weight < pathMax) {
+                        cout << "Weryfikacja: krawędź " << label(a) << " - " << label(b) << " (" << queries[q].weight
+                             << ") jest lżejsza od krawędzi drzewa na ścieżce (" << pathMax << ")." << endl;
+                        ok = false;
+                    }
+                }
+
+                // Podłącz x do rodzica
+                if (treeParent[x] != -1) {
+                    link[x] = treeParent[x];
+                    maxW[x] = parentWeight[x];
                 }
             }
         }
-        
-        // Alokacja tablicy wynikowej MST
-        Edge* result = new Edge[V - 1];
-        
-        // Tworzenie podzbiorów dla union-find
-        Subset* subsets = new Subset[V];
-        for (int i = 0; i < V; i++) {
-            subsets[i].parent = i;
-            subsets[i].rank = 0;
+
+        TRACE_PHASE_END(lcaPhase);
+
+        delete[] treeStart;
+        delete[] treeAdj;
+        delete[] treeWeight;
+        delete[] fill;
+        delete[] queries;
+        delete[] queryStart;
+        delete[] queryAdj;
+        delete[] link;
+        delete[] maxW;
+        delete[] state;
+        delete[] component;
+        delete[] treeParent;
+        delete[] parentWeight;
+        delete[] nextEdge;
+        delete[] stack;
+        delete[] path;
+        delete[] bucketHead;
+        delete[] bucketNext;
+
+        return ok;
+    }
+
+    // Weryfikacja ostatnio wyznaczonego MST
+    bool verifyLastMST() {
+        return verifyMST(mstEdges, mstEdgeCount);
+    }
+
+    // Wybierz najszybszy silnik MST według modelu kosztów (bez uruchamiania)
+    MSTEngine chooseMSTEngine(string& reason) {
+        MSTCostModel& model = mstCostModel();
+        int cores = (int)thread::hardware_concurrency();
+
+        ostringstream why;
+        why << "V = " << V << ", E = " << E << ", gęstość = " << density << ", rdzenie = " << cores << "; ";
+        if (!model.calibrated) {
+            why << "model domyślny (brak kalibracji); ";
+        } else if (model.cores != cores) {
+            why << "kalibracja z maszyny o " << model.cores << " rdzeniach - zalecana ponowna; ";
+        } else {
+            why << "model skalibrowany; ";
         }
-        
-        int resultIndex = 0;  // Indeks dla tablicy wynikowej
-        int i = 0;  // Indeks dla tablicy posortowanych krawędzi
-        
-        // Budowanie MST
-        while (resultIndex < V - 1 && i < edgeCount) {
-            Edge nextEdge = edges[i++];
-            
-            int x = find(subsets, nextEdge.source);
-            int y = find(subsets, nextEdge.destination);
-            
-            // Jeśli dodanie krawędzi nie tworzy cyklu, dodaj ją do MST
-            if (x != y) {
-                result[resultIndex++] = nextEdge;
-                Union(subsets, x, y);
+
+        MSTEngine best = MST_PRIM_MATRIX;
+        double bestCost = 0;
+        why << "szacowane czasy [us]:";
+        for (int e = 0; e < MST_ENGINE_COUNT; e++) {
+            MSTEngine engine = (MSTEngine)e;
+            double cost = model.fixed[e] + model.perUnit[e] * mstEngineWork(engine, V, E);
+            // Silniki na liście skompresowanej płacą za jej budowę, jeśli jest nieaktualna
+            if ((engine == MST_PRIM_COMPRESSED || engine == MST_BORUVKA_COMPRESSED) && !compValid) {
+                cost += model.buildFixed + model.buildPerUnit * compressedBuildWork(V, E);
+            }
+            why << " " << mstEngineName(engine) << " " << cost << (e + 1 < MST_ENGINE_COUNT ? "," : ";");
+            if (e == 0 || cost < bestCost) {
+                best = engine;
+                bestCost = cost;
             }
         }
-        
-        // Wyświetl krawędzie MST i oblicz sumę wag
-        int totalWeight = 0;
-        cout << "Krawędź \tWaga\n";
-        for (i = 0; i < resultIndex; i++) {
-            cout << result[i].source << " - " << result[i].destination << " \t" << result[i].weight << endl;
-            totalWeight += result[i].weight;
+        why << " wybrano " << mstEngineName(best) << " jako najtańszy";
+
+        reason = why.str();
+        return best;
+    }
+
+    // Wyznacz MST najszybszym dostępnym silnikiem; przy pierwszym użyciu wczytuje kalibrację z pliku
+    MSTEngine computeMST() {
+        TRACE_SCOPE("computeMST");
+
+        static bool loadAttempted = false;
+        if (!loadAttempted && !mstCostModel().calibrated) {
+            loadAttempted = true;
+            loadCostModel(MST_CALIBRATION_FILE);
         }
-        cout << "Suma wag MST: " << totalWeight << endl;
-        
-        delete[] result;
-        delete[] subsets;
-        delete[] edges;
+
+        chosenEngine = chooseMSTEngine(chosenReason);
+        runMSTEngine(chosenEngine);
+        return chosenEngine;
+    }
+
+    // Silnik wybrany przez ostatnie computeMST (MST_ENGINE_COUNT - jeszcze nie wywołano)
+    MSTEngine getChosenEngine() { return chosenEngine; }
+    const string& getChosenReason() { return chosenReason; }
+
+    // Wczytaj kalibrację modelu kosztów z pliku
+    static bool loadCostModel(const string& filename) {
+        ifstream file(filename);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        MSTCostModel model;
+        string name;
+        int loaded = 0;
+        file >> name >> model.cores;
+        if (name != "rdzenie") {
+            cout << "Nieprawidłowy format pliku kalibracji " << filename << endl;
+            return false;
+        }
+        int id;
+        double a, b;
+        while (file >> name >> a >> b) {
+            if (name == "budowa") {
+                model.buildFixed = a;
+                model.buildPerUnit = b;
+                loaded++;
+            } else if (sscanf(name.c_str(), "silnik%d", &id) == 1 && id >= 0 && id < MST_ENGINE_COUNT) {
+                model.fixed[id] = a;
+                model.perUnit[id] = b;
+                loaded++;
+            }
+        }
+        if (loaded != MST_ENGINE_COUNT + 1) {
+            cout << "Niekompletny plik kalibracji " << filename << endl;
+            return false;
+        }
+
+        model.calibrated = true;
+        mstCostModel() = model;
+        return true;
+    }
+
+    // Kalibracja modelu kosztów krótkim pomiarem na losowych grafach; wynik zapisywany do pliku
+    static bool calibrateCostModel(const string& filename) {
+        TRACE_SCOPE("calibrateCostModel");
+
+        int sizes[] = {40, 80, 160, 320};
+        double densities[] = {0.1, 0.4, 0.9};
+        const double kruskalWorkLimit = 2e7; // sortowanie bąbelkowe - pomijamy zbyt duże instancje
+
+        vector<double> work[MST_ENGINE_COUNT], time[MST_ENGINE_COUNT];
+        vector<double> buildWork, buildTime;
+
+        // Wyniki algorytmów nie są potrzebne - wyłączamy wypisywanie na czas pomiaru
+        streambuf* coutBuffer = cout.rdbuf(nullptr);
+        for (int s = 0; s < 4; s++) {
+            for (int d = 0; d < 3; d++) {
+                Graph graph(sizes[s]);
+                graph.generateRandom(densities[d]);
+
+                high_resolution_clock::time_point startTime = high_resolution_clock::now();
+                graph.buildCompressed();
+                buildTime.push_back(duration_cast<nanoseconds>(high_resolution_clock::now() - startTime).count() / 1000.0);
+                buildWork.push_back(compressedBuildWork(graph.V, graph.E));
+
+                for (int e = 0; e < MST_ENGINE_COUNT; e++) {
+                    MSTEngine engine = (MSTEngine)e;
+                    double units = mstEngineWork(engine, graph.V, graph.E);
+                    if ((engine == MST_KRUSKAL_MATRIX || engine == MST_KRUSKAL_LIST) && units > kruskalWorkLimit) continue;
+
+                    startTime = high_resolution_clock::now();
+                    graph.runMSTEngine(engine);
+                    time[e].push_back(duration_cast<nanoseconds>(high_resolution_clock::now() - startTime).count() / 1000.0);
+                    work[e].push_back(units);
+                }
+            }
+        }
+        cout.rdbuf(coutBuffer);
+        cout.clear();
+
+        MSTCostModel model;
+        for (int e = 0; e < MST_ENGINE_COUNT; e++) {
+            fitCost(work[e], time[e], model.fixed[e], model.perUnit[e]);
+        }
+        fitCost(buildWork, buildTime, model.buildFixed, model.buildPerUnit);
+        model.calibrated = true;
+        mstCostModel() = model;
+
+        ofstream file(filename);
+        if (!file.is_open()) {
+            cout << "Nie można zapisać pliku " << filename << endl;
+            return false;
+        }
+        file << "rdzenie " << model.cores << endl;
+        for (int e = 0; e < MST_ENGINE_COUNT; e++) {
+            file << "silnik" << e << " " << model.fixed[e] << " " << model.perUnit[e] << endl;
+        }
+        file << "budowa " << model.buildFixed << " " << model.buildPerUnit << endl;
+        file.close();
+        return true;
+    }
+
+    // Czas algorytmu [mikrosekundy] mierzony po jednym niemierzonym przebiegu rozgrzewającym;
+    // wyjście obu przebiegów jest wyciszone, aby mierzyć algorytm, a nie wypisywanie krawędzi
+    static double timeWarm(Graph& graph, void (Graph::*algorithm)()) {
+        streambuf* coutBuffer = cout.rdbuf(nullptr);
+        (graph.*algorithm)();
+
+        high_resolution_clock::time_point startTime = high_resolution_clock::now();
+        (graph.*algorithm)();
+        double elapsed = duration_cast<microseconds>(high_resolution_clock::now() - startTime).count();
+
+        cout.rdbuf(coutBuffer);
+        cout.clear();
+        return elapsed;
     }
 
     // Metoda do testowania wydajności algorytmów
-    void performanceTest(int numVertices, double density, int numTests) {
+    void performanceTest(int numVertices, double density, int numTests, ReorderMode reorderMode = REORDER_NONE) {
         Graph graph(numVertices);
 
         // Zmienne do mierzenia czasu
         high_resolution_clock::time_point startTime, endTime;
         double primMatrixTotal = 0, primListTotal = 0, kruskalMatrixTotal = 0, kruskalListTotal = 0;
+        double reorderTotal = 0, primListReorderedTotal = 0, kruskalListReorderedTotal = 0;
+        double primListBaselineTotal = 0, kruskalListBaselineTotal = 0;
+        double compressTotal = 0, primCompressedTotal = 0, boruvkaCompressedTotal = 0;
+        double sweepListTotal = 0, sweepCompressedTotal = 0;
+        long long listBytes = 0;
+        long long compressedBytes = 0;
+        double dijkstraMatrixTotal = 0, dijkstraListTotal = 0, deltaMatrixTotal = 0, deltaListTotal = 0;
+        double verifyTotal = 0;
+        int verifyCount = 0, invalidCount = 0;
+
+        // Weryfikacja wyniku właśnie wykonanego algorytmu (poza mierzonym czasem algorytmu)
+        auto verify = [&]() {
+            high_resolution_clock::time_point verifyStart = high_resolution_clock::now();
+            if (!graph.verifyLastMST()) invalidCount++;
+            verifyTotal += duration_cast<microseconds>(high_resolution_clock::now() - verifyStart).count();
+            verifyCount++;
+        };
 
         for (int test = 0; test < numTests; test++) {
             // Generuj nowy losowy graf dla każdego testu
@@ -591,24 +2349,114 @@ public:
             graph.primMST_Matrix();
             endTime = high_resolution_clock::now();
             primMatrixTotal += duration_cast<microseconds>(endTime - startTime).count();
+            verify();
 
             // Mierz czas dla algorytmu Prima (listowo)
             startTime = high_resolution_clock::now();
             graph.primMST_List();
             endTime = high_resolution_clock::now();
             primListTotal += duration_cast<microseconds>(endTime - startTime).count();
+            verify();
 
             // Mierz czas dla algorytmu Kruskala (macierzowo)
             startTime = high_resolution_clock::now();
             graph.kruskalMST_Matrix();
             endTime = high_resolution_clock::now();
             kruskalMatrixTotal += duration_cast<microseconds>(endTime - startTime).count();
+            verify();
 
             // Mierz czas dla algorytmu Kruskala (listowo)
             startTime = high_resolution_clock::now();
             graph.kruskalMST_List();
             endTime = high_resolution_clock::now();
             kruskalListTotal += duration_cast<microseconds>(endTime - startTime).count();
+            verify();
+
+            // Mierz koszt budowy reprezentacji skompresowanej
+            startTime = high_resolution_clock::now();
+            graph.buildCompressed();
+            endTime = high_resolution_clock::now();
+            compressTotal += duration_cast<microseconds>(endTime - startTime).count();
+            listBytes += graph.listMemoryBytes();
+            compressedBytes += graph.compressedMemoryBytes();
+
+            // Mierz przepustowość przeglądania sąsiadów w obu reprezentacjach
+            volatile long long checksum = 0;
+            startTime = high_resolution_clock::now();
+            checksum += graph.sweepList();
+            endTime = high_resolution_clock::now();
+            sweepListTotal += duration_cast<nanoseconds>(endTime - startTime).count() / 1000.0;
+
+            startTime = high_resolution_clock::now();
+            checksum += graph.sweepCompressed();
+            endTime = high_resolution_clock::now();
+            sweepCompressedTotal += duration_cast<nanoseconds>(endTime - startTime).count() / 1000.0;
+
+            // Mierz czas dla algorytmu Prima (lista skompresowana)
+            startTime = high_resolution_clock::now();
+            graph.primMST_Compressed();
+            endTime = high_resolution_clock::now();
+            primCompressedTotal += duration_cast<microseconds>(endTime - startTime).count();
+            verify();
+
+            // Mierz czas dla algorytmu Borůvki (lista skompresowana)
+            startTime = high_resolution_clock::now();
+            graph.boruvkaMST_Compressed();
+            endTime = high_resolution_clock::now();
+            boruvkaCompressedTotal += duration_cast<microseconds>(endTime - startTime).count();
+            verify();
+
+            // Mierz czas dla algorytmu Dijkstry (macierzowo)
+            startTime = high_resolution_clock::now();
+            graph.dijkstraSP_Matrix(0);
+            endTime = high_resolution_clock::now();
+            dijkstraMatrixTotal += duration_cast<microseconds>(endTime - startTime).count();
+
+            // Mierz czas dla algorytmu Dijkstry (listowo)
+            startTime = high_resolution_clock::now();
+            graph.dijkstraSP_List(0);
+            endTime = high_resolution_clock::now();
+            dijkstraListTotal += duration_cast<microseconds>(endTime - startTime).count();
+
+            // Mierz czas dla algorytmu delta-stepping (macierzowo)
+            startTime = high_resolution_clock::now();
+            graph.deltaSteppingSP_Matrix(0);
+            endTime = high_resolution_clock::now();
+            deltaMatrixTotal += duration_cast<microseconds>(endTime - startTime).count();
+
+            // Mierz czas dla algorytmu delta-stepping (listowo)
+            startTime = high_resolution_clock::now();
+            graph.deltaSteppingSP_List(0);
+            endTime = high_resolution_clock::now();
+            deltaListTotal += duration_cast<microseconds>(endTime - startTime).count();
+
+            if (reorderMode != REORDER_NONE) {
+                // Linia bazowa: permutacja tożsamościowa przebudowuje listy tak samo jak przenumerowanie,
+                // więc obie wersje różnią się wyłącznie kolejnością wierzchołków, a nie rozmieszczeniem węzłów
+                int* identity = new int[numVertices];
+                for (int i = 0; i < numVertices; i++) {
+                    identity[i] = i;
+                }
+                graph.applyOrder(identity);
+                delete[] identity;
+
+                primListBaselineTotal += timeWarm(graph, &Graph::primMST_List);
+                verify();
+                kruskalListBaselineTotal += timeWarm(graph, &Graph::kruskalMST_List);
+                verify();
+
+                // Mierz koszt przenumerowania
+                startTime = high_resolution_clock::now();
+                graph.reorderVertices(reorderMode);
+                endTime = high_resolution_clock::now();
+                reorderTotal += duration_cast<microseconds>(endTime - startTime).count();
+
+                // Powtórz wersje listowe na przenumerowanym grafie
+                primListReorderedTotal += timeWarm(graph, &Graph::primMST_List);
+                verify();
+                kruskalListReorderedTotal += timeWarm(graph, &Graph::kruskalMST_List);
+                verify();
+            }
         }
 
         // Oblicz średnie czasy
@@ -623,10 +2471,295 @@ public:
         cout << "Algorytm Prima (listowo): " << primListAvg << " mikrosekund" << endl;
         cout << "Algorytm Kruskala (macierzowo): " << kruskalMatrixAvg << " mikrosekund" << endl;
         cout << "Algorytm Kruskala (listowo): " << kruskalListAvg << " mikrosekund" << endl;
+        cout << "Algorytm Prima (lista skompresowana): " << primCompressedTotal / numTests << " mikrosekund" << endl;
+        cout << "Algorytm Borůvki (lista skompresowana): " << boruvkaCompressedTotal / numTests << " mikrosekund" << endl;
+        cout << "Budowa listy skompresowanej: " << compressTotal / numTests << " mikrosekund" << endl;
+        cout << "Pamięć listy sąsiedztwa: " << listBytes / numTests << " B, listy skompresowanej: " << compressedBytes / numTests << " B" << endl;
+        cout << "Przegląd wszystkich sąsiadów (listowo): " << sweepListTotal / numTests << " mikrosekund, (skompresowana): "
+             << sweepCompressedTotal / numTests << " mikrosekund" << endl;
+        cout << "Algorytm Dijkstry (macierzowo): " << dijkstraMatrixTotal / numTests << " mikrosekund" << endl;
+        cout << "Algorytm Dijkstry (listowo): " << dijkstraListTotal / numTests << " mikrosekund" << endl;
+        cout << "Algorytm delta-stepping (macierzowo): " << deltaMatrixTotal / numTests << " mikrosekund" << endl;
+        cout << "Algorytm delta-stepping (listowo): " << deltaListTotal / numTests << " mikrosekund" << endl;
+        cout << "Weryfikacja MST: " << verifyTotal / verifyCount << " mikrosekund na wynik, błędnych wyników: " << invalidCount << endl;
+
+        if (reorderMode != REORDER_NONE) {
+            double reorderAvg = reorderTotal / numTests;
+            double primListReorderedAvg = primListReorderedTotal / numTests;
+            double kruskalListReorderedAvg = kruskalListReorderedTotal / numTests;
+            double primListBaselineAvg = primListBaselineTotal / numTests;
+            double kruskalListBaselineAvg = kruskalListBaselineTotal / numTests;
+            double gain = (primListBaselineAvg - primListReorderedAvg) + (kruskalListBaselineAvg - kruskalListReorderedAvg);
+
+            cout << "Algorytm Prima (listowo, linia bazowa): " << primListBaselineAvg << " mikrosekund" << endl;
+            cout << "Algorytm Kruskala (listowo, linia bazowa): " << kruskalListBaselineAvg << " mikrosekund" << endl;
+            cout << "Przenumerowanie (" << reorderModeName(reorderMode) << "): " << reorderAvg << " mikrosekund" << endl;
+            cout << "Algorytm Prima (listowo, po przenumerowaniu): " << primListReorderedAvg << " mikrosekund" << endl;
+            cout << "Algorytm Kruskala (listowo, po przenumerowaniu): " << kruskalListReorderedAvg << " mikrosekund" << endl;
+            cout << "Zysk z przenumerowania: " << gain << " mikrosekund, bilans po odjęciu kosztu: " << gain - reorderAvg << " mikrosekund" << endl;
+        }
+    }
+
+    // Numer wewnętrzny wierzchołka o podanym numerze pierwotnym (-1 - brak)
+    int internalId(int original) {
+        if (!origId) return (original >= 0 && original < V) ? original : -1;
+        for (int v = 0; v < V; v++) {
+            if (origId[v] == original) return v;
+        }
+        return -1;
     }
 
     // Gettery
     int getVertices() { return V; }
     int getEdges() { return E; }
     double getDensity() { return density; }
-};
\ No newline at end of file
+};
+
+// Wczytywanie krawędzi w postaci rekordów "src dst w" ze strumienia (stdin, potok, plik)
+// dużymi blokami, bez kopiowania całego wejścia do pamięci
+class StreamEdgeReader {
+private:
+    static const size_t BUFFER_SIZE = 1 << 20;
+
+    FILE* input;
+    char* buffer;
+    size_t size; // liczba bajtów w buforze
+    size_t pos;  // bieżąca pozycja w buforze
+    bool error;
+
+    // Następny znak strumienia (-1 - koniec danych)
+    int nextChar() {
+        if (pos == size) {
+            size = fread(buffer, 1, BUFFER_SIZE, input);
+            pos = 0;
+            if (size == 0) return -1;
+        }
+        return (unsigned char)buffer[pos++];
+    }
+
+    // Wczytaj liczbę całkowitą; false - koniec danych przed liczbą
+    bool readInt(int& value) {
+        int c = nextChar();
+        while (c == ' ' || c == '\t' || c == '\n' || c == '\r') c = nextChar();
+        if (c == -1) return false;
+
+        bool negative = false;
+        if (c == '-') {
+            negative = true;
+            c = nextChar();
+        }
+        if (c < '0' || c > '9') {
+            error = true;
+            return false;
+        }
+        long long result = 0;
+        while (c >= '0' && c <= '9') {
+            result = result * 10 + (c - '0');
+            if (result > INT_MAX) {
+                error = true;
+                return false;
+            }
+            c = nextChar();
+        }
+        value = negative ? -(int)result : (int)result;
+
+        // Liczba musi kończyć się białym znakiem lub końcem danych
+        if (c != -1 && c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+            error = true;
+            return false;
+        }
+        return true;
+    }
+
+public:
+    StreamEdgeReader(FILE* input) {
+        this->input = input;
+        this->buffer = new char[BUFFER_SIZE];
+        this->size = 0;
+        this->pos = 0;
+        this->error = false;
+    }
+
+    ~StreamEdgeReader() {
+        delete[] buffer;
+    }
+
+    // Wczytaj do maxEdges krawędzi; zwraca liczbę wczytanych (0 - koniec strumienia lub błąd)
+    int readBatch(Edge* out, int maxEdges) {
+        int count = 0;
+        while (count < maxEdges && !error) {
+            int src, dest, weight;
+            if (!readInt(src)) break;
+            if (!readInt(dest) || !readInt(weight)) {
+                error = true; // niepełny rekord
+                break;
+            }
+            out[count++] = {src, dest, weight};
+        }
+        return count;
+    }
+
+    // Czy wejście zawierało niepoprawne dane
+    bool failed() { return error; }
+};
+
+// MST strumienia krawędzi w pamięci O(V): przechowywany jest tylko bieżący las rozpinający.
+// Każda partia krawędzi jest łączona z lasem, a MST sumy wyznaczany algorytmem Kruskala -
+// krawędź odrzucona w sumie nie należy do MST żadnego większego zbioru krawędzi.
+// Identyfikatory ze strumienia są mapowane na kolejne indeksy, więc pamięć zależy od liczby
+// różnych wierzchołków, a nie od największego identyfikatora.
+class StreamingMST {
+private:
+    vector<Edge> forest; // krawędzie lasu posortowane według wag (indeksy wewnętrzne)
+    vector<Edge> merged; // bufor roboczy: las + bieżąca partia
+    vector<int> parent;  // union-find
+    vector<int> rank;
+    unordered_map<int, int> index; // identyfikator ze strumienia -> indeks wewnętrzny
+    vector<int> origId;            // indeks wewnętrzny -> identyfikator ze strumienia
+    long long totalWeight;
+    long long edgesSeen;
+    int vertexCount;
+    int batches;
+
+    // Znajduje reprezentanta zbioru (iteracyjnie, z połowieniem ścieżki)
+    int find(int x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+
+    // Indeks wewnętrzny identyfikatora; nowy identyfikator dostaje kolejny wolny indeks
+    int internalIndex(int id) {
+        auto it = index.find(id);
+        if (it != index.end()) return it->second;
+        index.emplace(id, vertexCount);
+        origId.push_back(id);
+        return vertexCount++;
+    }
+
+public:
+    // vertices - przewidywana liczba różnych wierzchołków (tylko rezerwacja pamięci)
+    StreamingMST(int vertices = 0) {
+        this->totalWeight = 0;
+        this->edgesSeen = 0;
+        this->vertexCount = 0;
+        this->batches = 0;
+        if (vertices > 0) {
+            index.reserve(vertices);
+            origId.reserve(vertices);
+        }
+    }
+
+    // Dołącz partię krawędzi i przelicz las rozpinający; false - partia zawierała błędne indeksy
+    // wierzchołków (takie rekordy są pomijane, pozostałe krawędzie partii są uwzględniane)
+    bool addBatch(Edge* batch, int count) {
+        TRACE_SCOPE("StreamingMST.addBatch");
+
+        // Najpierw odrzucamy błędne rekordy, dopiero potem zmieniamy stan lasu
+        bool ok = true;
+        int valid = 0;
+        for (int i = 0; i < count; i++) {
+            if (batch[i].source < 0 || batch[i].destination < 0) {
+                cout << "Błędne indeksy wierzchołków w strumieniu: " << batch[i].source << " lub " << batch[i].destination << endl;
+                ok = false;
+                continue;
+            }
+            batch[valid++] = batch[i];
+        }
+        edgesSeen += count;
+        batches++;
+        count = valid;
+
+        // Liczba wierzchołków rośnie wraz z pojawianiem się nowych identyfikatorów
+        for (int i = 0; i < count; i++) {
+            batch[i].source = internalIndex(batch[i].source);
+            batch[i].destination = internalIndex(batch[i].destination);
+        }
+        parent.resize(vertexCount);
+        rank.resize(vertexCount);
+
+        TRACE_PHASE_BEGIN(sortPhase, "StreamingMST.sort");
+        // Las jest już posortowany - sortujemy tylko partię i scalamy
+        sort(batch, batch + count, [](const Edge& a, const Edge& b) { return a.weight < b.weight; });
+        merged.resize(forest.size() + count);
+        std::merge(forest.begin(), forest.end(), batch, batch + count, merged.begin(),
+                   [](const Edge& a, const Edge& b) { return a.weight < b.weight; });
+        TRACE_PHASE_END(sortPhase);
+
+        TRACE_PHASE_BEGIN(unionFindPhase, "StreamingMST.unionFind");
+        for (int i = 0; i < vertexCount; i++) {
+            parent[i] = i;
+            rank[i] = 0;
+        }
+
+        // Kruskal na sumie lasu i partii
+        forest.clear();
+        totalWeight = 0;
+        for (const Edge& e : merged) {
+            if ((int)forest.size() == vertexCount - 1) break;
+            int x = find(e.source);
+            int y = find(e.destination);
+            if (x == y) continue; // również pętle własne
+
+            forest.push_back(e);
+            totalWeight += e.weight;
+            if (rank[x] < rank[y]) parent[x] = y;
+            else if (rank[x] > rank[y]) parent[y] = x;
+            else {
+                parent[y] = x;
+                rank[x]++;
+            }
+        }
+        TRACE_PHASE_END(unionFindPhase);
+
+        return ok;
+    }
+
+    // Wczytuj strumień partiami po batchSize krawędzi aż do jego końca,
+    // wypisując stan lasu po każdej partii
+    bool processStream(FILE* input, int batchSize) {
+        StreamEdgeReader reader(input);
+        Edge* batch = new Edge[batchSize];
+        bool ok = true;
+
+        int count;
+        while ((count = reader.readBatch(batch, batchSize)) > 0) {
+            if (!addBatch(batch, count)) ok = false;
+            cout << "Partia " << batches << ": " << count << " krawędzi (łącznie " << edgesSeen << "), las: "
+                 << forest.size() << " krawędzi, składowe: " << getComponents() << ", suma wag: " << totalWeight << endl;
+        }
+        if (reader.failed()) {
+            cout << "Niepoprawny rekord w strumieniu po " << edgesSeen << " krawędziach." << endl;
+            ok = false;
+        }
+
+        delete[] batch;
+        return ok;
+    }
+
+    // Wyświetl krawędzie bieżącego lasu i sumę wag
+    void display() {
+        cout << "Krawędź \tWaga\n";
+        for (const Edge& e : forest) {
+            cout << origId[e.source] << " - " << origId[e.destination] << " \t" << e.weight << endl;
+        }
+        cout << "Suma wag MST: " << totalWeight << endl;
+    }
+
+    // Gettery
+    long long getTotalWeight() { return totalWeight; }
+    long long getEdgesSeen() { return edgesSeen; }
+    int getVertices() { return vertexCount; }
+    int getComponents() { return vertexCount - (int)forest.size(); }
+    // Krawędzie lasu z identyfikatorami ze strumienia
+    vector<Edge> getForest() {
+        vector<Edge> result(forest);
+        for (Edge& e : result) {
+            e.source = origId[e.source];
+            e.destination = origId[e.destination];
+        }
+        return result;
+    }
+};
@@ -19,6 +19,41 @@ void clearScreen() {
 #endif
 }
 
+// Porównanie pamięci listy sąsiedztwa i reprezentacji skompresowanej dla grafu z pliku.
+// Każda reprezentacja jest wczytywana osobno (bez macierzy sąsiedztwa) i zwalniana przed następną;
+// wypisywany jest przyrost pamięci rezydentnej procesu (Linux, /proc/self/status) i rozmiar struktury.
+bool memoryTest(const string& filename) {
+    long long rssBefore = processMemoryBytes("VmRSS");
+    {
+        CompressedGraph compressed;
+        if (!compressed.loadFromFile(filename)) return false;
+        long long rssDelta = processMemoryBytes("VmRSS") - rssBefore;
+
+        int vertices = compressed.getVertices();
+        Edge* mst = new Edge[vertices > 0 ? vertices : 1];
+        long long primWeight = 0, boruvkaWeight = 0;
+        int count = compressed.primMST(mst);
+        for (int i = 0; i < count; i++) primWeight += mst[i].weight;
+        count = compressed.boruvkaMST(mst);
+        for (int i = 0; i < count; i++) boruvkaWeight += mst[i].weight;
+        delete[] mst;
+
+        cout << "Graf: " << vertices << " wierzchołków, " << compressed.getEdges() << " krawędzi" << endl;
+        cout << "Lista skompresowana: " << compressed.memoryBytes() << " B, przyrost pamięci procesu: " << rssDelta << " B" << endl;
+        cout << "Suma wag MST: " << primWeight << " (Prim), " << boruvkaWeight << " (Borůvka)" << endl;
+    }
+
+    rssBefore = processMemoryBytes("VmRSS");
+    int vertices;
+    long long edges;
+    AdjListNode** adjList = loadAdjListFromFile(filename, vertices, edges);
+    if (!adjList) return false;
+    long long rssDelta = processMemoryBytes("VmRSS") - rssBefore;
+    cout << "Lista sąsiedztwa: " << adjListMemoryBytes(vertices, adjList) << " B, przyrost pamięci procesu: " << rssDelta << " B" << endl;
+    freeAdjList(vertices, adjList);
+    return true;
+}
+
 // Menu główne programu
 void menu() {
     Graph* graph = nullptr;
@@ -29,9 +64,18 @@ void menu() {
         cout << "1. Wczytaj graf z pliku" << endl;
         cout << "2. Wygeneruj losowy graf" << endl;
         cout << "3. Wyświetl graf" << endl;
-        cout << "4. Algorytm Prima (macierzowo i listowo)" << endl;
+        cout << "4. Algorytm Prima (macierzowo, listowo i na liście skompresowanej)" << endl;
         cout << "5. Algorytm Kruskala (macierzowo i listowo)" << endl;
         //cout << "6. Testy wydajności" << endl;
+        cout << "7. Przenumeruj wierzchołki (BFS, RCM, stopień)" << endl;
+        cout << "8. Najkrótsze ścieżki (Dijkstra macierzowo i listowo, delta-stepping)" << endl;
+        cout << "9. Algorytm Borůvki (lista skompresowana)" << endl;
+        cout << "10. MST z automatycznym wyborem algorytmu" << endl;
+        cout << "11. Kalibracja modelu kosztów" << endl;
+#ifdef GRAPH_TRACE
+        cout << "12. Zapisz ślad wykonania (Chrome trace)" << endl;
+#endif
+        cout << "13. MST strumieniowo z pliku lub potoku" << endl;
         cout << "0. Wyjście" << endl;
         cout << "Wybierz opcję: ";
 
@@ -110,7 +154,11 @@ void menu() {
                     break;
                 }
                 graph->primMST_Matrix();
+                cout << "Weryfikacja MST: " << (graph->verifyLastMST() ? "poprawne" : "błędne") << endl;
                 graph->primMST_List();
+                cout << "Weryfikacja MST: " << (graph->verifyLastMST() ? "poprawne" : "błędne") << endl;
+                graph->primMST_Compressed();
+                cout << "Weryfikacja MST: " << (graph->verifyLastMST() ? "poprawne" : "błędne") << endl;
                 break;
             }
             case 5: {
@@ -119,7 +167,9 @@ void menu() {
                     break;
                 }
                 graph->kruskalMST_Matrix();
+                cout << "Weryfikacja MST: " << (graph->verifyLastMST() ? "poprawne" : "błędne") << endl;
                 graph->kruskalMST_List();
+                cout << "Weryfikacja MST: " << (graph->verifyLastMST() ? "poprawne" : "błędne") << endl;
                 break;
             }
             case 6: {
@@ -142,10 +192,14 @@ void menu() {
                     cin >> density;
                     cout << "Podaj liczbę testów: ";
                     cin >> numTests;
+                    cout << "Przenumerowanie wierzchołków (0 - brak, 1 - BFS, 2 - RCM, 3 - stopień): ";
+                    int reorder;
+                    cin >> reorder;
+                    if (reorder < REORDER_NONE || reorder > REORDER_DEGREE) reorder = REORDER_NONE;
                     
                     if (graph) delete graph;
                     graph = new Graph(size);
-                    graph->performanceTest(size, density, numTests);
+                    graph->performanceTest(size, density, numTests, (ReorderMode)reorder);
                 }
                 else if (testChoice == 2) {
                     int sizes[] = {10, 20, 50, 100, 200, 500, 1000}; // 7 różnych rozmiarów
@@ -164,6 +218,107 @@ void menu() {
                 }
                 break;
             }
+            case 7: {
+                if (!graph) {
+                    cout << "Najpierw wczytaj lub wygeneruj graf!" << endl;
+                    break;
+                }
+                cout << "Wybierz kolejność (1 - BFS, 2 - RCM, 3 - stopień): ";
+                int reorder;
+                cin >> reorder;
+                if (reorder < REORDER_BFS || reorder > REORDER_DEGREE) {
+                    cout << "Nieprawidłowy tryb przenumerowania!" << endl;
+                    break;
+                }
+                graph->reorderVertices((ReorderMode)reorder);
+                cout << "Przenumerowano wierzchołki (" << reorderModeName((ReorderMode)reorder) << ")." << endl;
+                break;
+            }
+            case 8: {
+                if (!graph) {
+                    cout << "Najpierw wczytaj lub wygeneruj graf!" << endl;
+                    break;
+                }
+                cout << "Podaj wierzchołek źródłowy: ";
+                int source;
+                cin >> source;
+                source = graph->internalId(source);
+                if (source == -1) {
+                    cout << "Nieprawidłowy wierzchołek!" << endl;
+                    break;
+                }
+                graph->dijkstraSP_Matrix(source);
+                graph->dijkstraSP_List(source);
+                graph->deltaSteppingSP_Matrix(source);
+                graph->deltaSteppingSP_List(source);
+                break;
+            }
+            case 9: {
+                if (!graph) {
+                    cout << "Najpierw wczytaj lub wygeneruj graf!" << endl;
+                    break;
+                }
+                graph->boruvkaMST_Compressed();
+                cout << "Weryfikacja MST: " << (graph->verifyLastMST() ? "poprawne" : "błędne") << endl;
+                cout << "Pamięć listy sąsiedztwa: " << graph->listMemoryBytes() << " B, listy skompresowanej: "
+                     << graph->compressedMemoryBytes() << " B" << endl;
+                break;
+            }
+            case 10: {
+                if (!graph) {
+                    cout << "Najpierw wczytaj lub wygeneruj graf!" << endl;
+                    break;
+                }
+                graph->computeMST();
+                cout << "Weryfikacja MST: " << (graph->verifyLastMST() ? "poprawne" : "błędne") << endl;
+                cout << "Wybrany algorytm: " << mstEngineName(graph->getChosenEngine()) << endl;
+                cout << "Uzasadnienie: " << graph->getChosenReason() << endl;
+                break;
+            }
+            case 11: {
+                cout << "Kalibracja modelu kosztów..." << endl;
+                if (Graph::calibrateCostModel(MST_CALIBRATION_FILE)) {
+                    cout << "Zapisano kalibrację do pliku " << MST_CALIBRATION_FILE << endl;
+                }
+                break;
+            }
+            case 13: {
+                string filename;
+                int batchSize;
+                cout << "Podaj nazwę pliku lub potoku z rekordami \"src dst w\": ";
+                cin >> filename;
+                cout << "Podaj rozmiar partii (liczba krawędzi): ";
+                cin >> batchSize;
+                if (batchSize <= 0) {
+                    cout << "Nieprawidłowy rozmiar partii!" << endl;
+                    break;
+                }
+
+                FILE* input = fopen(filename.c_str(), "r");
+                if (!input) {
+                    cout << "Nie można otworzyć pliku " << filename << endl;
+                    break;
+                }
+                StreamingMST stream;
+                stream.processStream(input, batchSize);
+                fclose(input);
+                cout << "Suma wag MST: " << stream.getTotalWeight() << endl;
+                break;
+            }
+#ifdef GRAPH_TRACE
+            case 12: {
+                string filename;
+                cout << "Podaj nazwę pliku (np. trace.json): ";
+                cin >> filename;
+                if (Tracer::instance().writeChromeTrace(filename)) {
+                    cout << "Zapisano " << Tracer::instance().size() << " zdarzeń do pliku " << filename << endl;
+                    cout << "Plik można otworzyć w chrome://tracing lub ui.perfetto.dev" << endl;
+                } else {
+                    cout << "Nie można zapisać pliku " << filename << endl;
+                }
+                break;
+            }
+#endif
             default:
                 cout << "Nieprawidłowa opcja!" << endl;
         }
@@ -174,9 +329,27 @@ void menu() {
     }
 }
 
-int main() {
+int main(int argc, char* argv[]) {
     srand(static_cast<unsigned>(time(nullptr))); // Inicjalizacja generatora liczb losowych
 
+    // Tryb strumieniowy: ./main --stream [rozmiar_partii] < krawedzie.txt
+    if (argc > 1 && string(argv[1]) == "--stream") {
+        int batchSize = argc > 2 ? atoi(argv[2]) : 1 << 20;
+        if (batchSize <= 0) {
+            cout << "Nieprawidłowy rozmiar partii!" << endl;
+            return 1;
+        }
+        StreamingMST stream;
+        bool ok = stream.processStream(stdin, batchSize);
+        stream.display();
+        return ok ? 0 : 1;
+    }
+
+    // Porównanie pamięci: ./main --memory-test graf.txt
+    if (argc > 2 && string(argv[1]) == "--memory-test") {
+        return memoryTest(argv[2]) ? 0 : 1;
+    }
+
     menu();
 
     return 0;
@@ -0,0 +1,217 @@
+// Lekkie śledzenie faz algorytmów z zapisem w formacie Chrome trace-event
+// (do otwarcia w chrome://tracing lub ui.perfetto.dev).
+// Śledzenie włącza flaga kompilacji -DGRAPH_TRACE (make trace); bez niej wszystkie
+// makra rozwijają się do pustych instrukcji i nie kosztują nic.
+#pragma once
+
+#ifdef GRAPH_TRACE
+
+#include <chrono>
+#include <fstream>
+#include <initializer_list>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+// Pojedyncze zdarzenie ("complete event"), czasy w nanosekundach od startu programu
+struct TraceEvent {
+    const char* name;
+    long long start;
+    long long duration;
+    int tid;
+    long long calls; // > 0 - zdarzenie zagregowane z wielu krótkich odcinków
+};
+
+// Globalny rejestr zdarzeń, bezpieczny dla wielu wątków.
+// Wiersze śladu: 0 - wątek główny, 1..WORKER_SLOTS - stałe miejsca wątków roboczych
+// (numer nadaje wywołujący, więc wątki tworzone w każdej fazie trafiają do tych samych wierszy),
+// od THREAD_BASE - pozostałe wątki numerowane automatycznie.
+class Tracer {
+public:
+    static const int WORKER_SLOTS = 1000;
+    static const int THREAD_BASE = WORKER_SLOTS + 1;
+
+private:
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    std::chrono::steady_clock::time_point origin;
+    int nextTid;
+
+    Tracer() : origin(std::chrono::steady_clock::now()), nextTid(0) {}
+
+    // Nazwa wiersza śladu
+    static std::string threadName(int tid) {
+        if (tid == 0) return "main";
+        if (tid < THREAD_BASE) return "worker " + std::to_string(tid - 1);
+        return "thread " + std::to_string(tid - THREAD_BASE + 1);
+    }
+
+    // Zapis nazwy z ucieczką znaków specjalnych JSON
+    static void writeName(std::ofstream& file, const char* name) {
+        file << '"';
+        for (const char* c = name; *c; c++) {
+            if (*c == '"' || *c == '\\') file << '\\';
+            file << *c;
+        }
+        file << '"';
+    }
+
+public:
+    static Tracer& instance() {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    long long now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count();
+    }
+
+    // Wiersz bieżącego wątku (0 - pierwszy wątek, który coś zarejestrował)
+    int threadId() {
+        thread_local int id = -1;
+        if (id == -1) {
+            std::lock_guard<std::mutex> lock(mutex);
+            id = nextTid == 0 ? 0 : THREAD_BASE + nextTid - 1;
+            nextTid++;
+        }
+        return id;
+    }
+
+    // Wiersz stałego miejsca wątku roboczego o numerze slot (od 0)
+    static int workerTid(int slot) {
+        return slot < WORKER_SLOTS ? 1 + slot : WORKER_SLOTS;
+    }
+
+    // tid < 0 - wiersz bieżącego wątku
+    void record(const char* name, long long start, long long duration, long long calls = 0, int tid = -1) {
+        if (tid < 0) tid = threadId();
+        std::lock_guard<std::mutex> lock(mutex);
+        events.push_back({name, start, duration, tid, calls});
+    }
+
+    size_t size() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return events.size();
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        events.clear();
+    }
+
+    // Zapis wszystkich zdarzeń do pliku JSON w formacie Chrome trace-event
+    bool writeChromeTrace(const std::string& filename) {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::ofstream file(filename);
+        if (!file.is_open()) return false;
+
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        std::set<int> tids;
+        for (const TraceEvent& e : events) tids.insert(e.tid);
+        for (int t : tids) {
+            file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t
+                 << ",\"args\":{\"name\":\"" << threadName(t) << "\"}},\n";
+        }
+        file.setf(std::ios::fixed);
+        file.precision(3);
+        for (size_t i = 0; i < events.size(); i++) {
+            const TraceEvent& e = events[i];
+            file << "{\"name\":";
+            writeName(file, e.name);
+            file << ",\"cat\":\"graph\",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.tid
+                 << ",\"ts\":" << e.start / 1000.0 << ",\"dur\":" << e.duration / 1000.0;
+            if (e.calls > 0) file << ",\"args\":{\"calls\":" << e.calls << ",\"aggregated\":true}";
+            file << "}" << (i + 1 < events.size() ? ",\n" : "\n");
+        }
+        file << "]}\n";
+        return true;
+    }
+};
+
+// Odcinek czasu zapisywany przy wyjściu z zasięgu lub jawnym wywołaniu end()
+class TraceScope {
+private:
+    const char* name;
+    long long start;
+    int tid;
+    bool open;
+
+public:
+    // tid < 0 - wiersz bieżącego wątku
+    TraceScope(const char* name, int tid = -1) : name(name), start(Tracer::instance().now()), tid(tid), open(true) {}
+    ~TraceScope() { end(); }
+
+    void end() {
+        if (!open) return;
+        open = false;
+        Tracer::instance().record(name, start, Tracer::instance().now() - start, 0, tid);
+    }
+};
+
+// Suma wielu krótkich odcinków (np. jednej fazy w każdej iteracji pętli),
+// zapisywana jako jedno zdarzenie, aby nie zalewać śladu milionami wpisów
+class TraceAccumulator {
+public:
+    const char* name;
+    long long first;   // początek pierwszego odcinka (-1 - brak)
+    long long current; // początek bieżącego odcinka
+    long long total;
+    long long calls;
+
+    TraceAccumulator(const char* name) : name(name), first(-1), current(0), total(0), calls(0) {}
+
+    void begin() {
+        current = Tracer::instance().now();
+        if (first < 0) first = current;
+    }
+
+    void end() {
+        total += Tracer::instance().now() - current;
+        calls++;
+    }
+};
+
+// Zapis zsumowanych faz jako kolejnych odcinków od początku pierwszej z nich;
+// łączna długość nie przekracza czasu pętli, więc zdarzenia zagnieżdżają się poprawnie
+inline void traceEmitBreakdown(std::initializer_list<TraceAccumulator*> accumulators) {
+    long long cursor = -1;
+    for (TraceAccumulator* acc : accumulators) {
+        if (acc->first >= 0 && (cursor < 0 || acc->first < cursor)) cursor = acc->first;
+    }
+    if (cursor < 0) return;
+    for (TraceAccumulator* acc : accumulators) {
+        if (acc->calls == 0) continue;
+        Tracer::instance().record(acc->name, cursor, acc->total, acc->calls);
+        cursor += acc->total;
+    }
+}
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+// Odcinek obejmujący resztę bieżącego bloku
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope_, __LINE__)(name)
+// Odcinek w wierszu stałego miejsca wątku roboczego (dla wątków tworzonych na nowo w każdej fazie)
+#define TRACE_WORKER_SCOPE(name, slot) TraceScope TRACE_CONCAT(traceScope_, __LINE__)(name, Tracer::workerTid(slot))
+// Jawnie zamykana faza w obrębie funkcji
+#define TRACE_PHASE_BEGIN(var, name) TraceScope var(name)
+#define TRACE_PHASE_END(var) var.end()
+// Faza powtarzana w pętli, sumowana i zapisywana przez TRACE_EMIT_BREAKDOWN(&a, &b, ...)
+#define TRACE_ACCUMULATOR(var, name) TraceAccumulator var(name)
+#define TRACE_ACCUM_BEGIN(var) var.begin()
+#define TRACE_ACCUM_END(var) var.end()
+#define TRACE_EMIT_BREAKDOWN(...) traceEmitBreakdown({__VA_ARGS__})
+
+#else
+
+#define TRACE_SCOPE(name)
+#define TRACE_WORKER_SCOPE(name, slot)
+#define TRACE_PHASE_BEGIN(var, name)
+#define TRACE_PHASE_END(var)
+#define TRACE_ACCUMULATOR(var, name)
+#define TRACE_ACCUM_BEGIN(var)
+#define TRACE_ACCUM_END(var)
+#define TRACE_EMIT_BREAKDOWN(...)
+
+#endif